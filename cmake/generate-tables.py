@@ -0,0 +1,974 @@
+#!/usr/bin/env python3
+#
+# SPDX-License-Identifier: MIT
+# SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+#
+# Generates the structure layouts, views and decoded classes of the tables
+# described by the SMBIOS schema.
+#
+#   generate-tables.py [--tables=<name>,...] <schema.json> <output directory>
+#   generate-tables.py --list <schema.json> <output directory>
+#
+# Writes, under the output directory:
+#
+# - include/dmi/table/generated/<header>.h for every type of the schema;
+# - include/dmi/table/generated/tables.h, including all of them, listing
+#   the types in the DMI_GENERATED_TABLES() X-macro and the enabled ones in
+#   DMI_ENABLED_TABLES() and DMI_ENABLED_TABLE_TYPES;
+# - src/table/generated.cc, defining the C name functions of the enums of
+#   the enabled types and the fields dmidecode prints for them, for
+#   source::import_text().
+#
+# All the types are enabled by default. --tables restricts them to the given
+# list, which may also name the hand-written types listed in the schema: the
+# other types keep their views and decoded classes, which cost nothing until
+# used, but get no storage in the context, no validation and no C name
+# functions.
+#
+# Files are only rewritten when their contents change, so that a schema
+# edit does not rebuild the whole library.
+#
+# Each table of the schema has a structure type, a name (that of its
+# table_type value), the SMBIOS version it appeared in, its enums and its
+# fields in offset order. Fields have a kind:
+#
+# - u8, u16, u32, u64: little-endian integers;
+# - handle: structure handle, 0xFFFF meaning none;
+# - string: string number, 0 meaning none;
+# - enum: byte holding a value of one of the enums;
+# - bytes: fixed-size byte array;
+# - bits: word of bit fields, each a flag or a value of one of the enums.
+#
+# Fields newer than the structure, or marked optional (those the structure
+# may end before), are decoded as std::optional. Enums declared "extern"
+# are hand-written in the given header.
+#
+# Fields are matched to the `Label: value` lines of dmidecode by their name,
+# or by their "label" when dmidecode names them otherwise, a "unit" being
+# the one dmidecode prints after their value.
+#
+import json
+import sys
+from pathlib import Path
+
+HEADER_SIZE = 4
+
+SCALARS = {
+    'u8': ('uint8_t', 1),
+    'u16': ('uint16_t', 2),
+    'u32': ('uint32_t', 4),
+    'u64': ('uint64_t', 8),
+    'handle': ('dmi_handle_t', 2),
+    'string': ('uint8_t', 1),
+}
+
+WORDS = {1: 'uint8_t', 2: 'uint16_t', 4: 'uint32_t', 8: 'uint64_t'}
+
+TEXT_KINDS = {
+    'u8': 'integer',
+    'u16': 'integer',
+    'u32': 'integer',
+    'u64': 'integer',
+    'handle': 'handle',
+    'string': 'string',
+    'enum': 'enumeration',
+}
+
+KEYWORDS = {
+    'and', 'bool', 'char', 'class', 'default', 'delete', 'double', 'enum',
+    'float', 'int', 'long', 'new', 'not', 'or', 'private', 'public', 'short',
+    'signed', 'unsigned', 'union', 'void', 'xor',
+}
+
+LICENSE = '''//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+// Generated from schema/smbios.json by cmake/generate-tables.py, do not edit.
+//
+'''
+
+
+class SchemaError(Exception):
+    pass
+
+
+def number(value):
+    return int(value, 0) if isinstance(value, str) else int(value)
+
+
+def version(since):
+    major, minor = since.split('.')
+    return f'smbios_{major}_{minor}'
+
+
+def version_key(since):
+    return tuple(int(part) for part in since.split('.'))
+
+
+def identifier(name):
+    name = name.lower()
+    return name + '_' if name in KEYWORDS else name
+
+
+def c_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def comment(lines, indent):
+    pad = ' ' * indent
+    out = [f'{pad}/**']
+    out += [f'{pad} *' + (f' {line}' if line else '') for line in lines]
+    out.append(f'{pad} */')
+    return out
+
+
+def align(rows, indent, separator=' '):
+    '''Aligns the first column of (name, rest) rows.'''
+    width = max(len(name) for name, _ in rows)
+    pad = ' ' * indent
+    return [f'{pad}{name.ljust(width)}{separator}{rest}'.rstrip() for name, rest in rows]
+
+
+class Enum:
+    def __init__(self, spec, owner):
+        self.name = spec['name']
+        self.owner = owner
+        self.brief = spec['brief']
+        self.extern = spec.get('extern')
+        self.c_name = spec.get('c_name', f'dmi_{self.name}')
+        self.c_prefix = spec.get('c_prefix', f'DMI_{self.name.upper()}')
+        self.values = [(suffix, number(value), text) for suffix, value, text in spec.get('values', [])]
+
+        if self.values and max(value for _, value, _ in self.values) > 0xFF:
+            raise SchemaError(f'{self.name}: values must fit in a byte')
+
+    @property
+    def c_type(self):
+        return f'{self.c_name}_t'
+
+    @property
+    def size(self):
+        return max(value for _, value, _ in self.values) + 1
+
+    def c_declaration(self):
+        out = comment([f'@brief {self.brief}'], 0)
+        out.append(f'typedef enum {self.c_name} : uint8_t')
+        out.append('{')
+        rows = [(f'{self.c_prefix}_{suffix}', f'= 0x{value:02X}, //< {text}')
+                for suffix, value, text in self.values]
+        rows[-1] = (rows[-1][0], rows[-1][1].replace(',', ' ', 1))
+        out += align(rows, 4)
+        out.append(f'}} {self.c_type};')
+        return out
+
+    def cxx_declaration(self):
+        out = comment([f'@brief {self.brief}'], 4)
+        out.append(f'    enum class {self.name} : uint8_t')
+        out.append('    {')
+        rows = [(identifier(suffix), f'= {self.c_prefix}_{suffix}, //< {text}')
+                for suffix, _, text in self.values]
+        rows[-1] = (rows[-1][0], rows[-1][1].replace(',', ' ', 1))
+        out += align(rows, 8)
+        out.append('    };')
+        return out
+
+    def names(self):
+        out = [f'        inline constexpr dmi::detail::name_entry {self.name}_entries[] = {{']
+        rows = [(f'{{ {self.c_prefix}_{suffix},', f'{c_string(text)} }},') for suffix, _, text in self.values]
+        rows[-1] = (rows[-1][0], rows[-1][1].rstrip(','))
+        out += align(rows, 12)
+        out.append('        };')
+        out.append('')
+        out.append(f'        inline constexpr auto& {self.name}_names = '
+                   f'dmi::detail::names<{self.size}, {self.name}_entries>;')
+        return out
+
+    def functions(self):
+        out = []
+        for doc, signature, body in (
+            ('@brief Non-throwing to_string().',
+             f'constexpr auto try_to_string({self.name} value) noexcept -> result<std::string_view>',
+             f'return dmi::detail::try_name(detail::{self.name}_names, value);'),
+            ('@throws std::invalid_argument',
+             f'constexpr std::string_view to_string({self.name} value)',
+             f'return dmi::detail::to_name(detail::{self.name}_names, value);'),
+            ('@brief Name table, for dmi::from_string().',
+             f'constexpr const auto& names_of({self.name}) noexcept',
+             f'return detail::{self.name}_names;'),
+        ):
+            out += comment([doc], 4)
+            out += [f'    {signature}', '    {', f'        {body}', '    }', '']
+        return out
+
+
+class Bits:
+    def __init__(self, spec, word, enums):
+        self.name = spec['name']
+        self.shift = spec['shift']
+        self.width = spec['width']
+        self.brief = spec['brief']
+        self.enum = enums[spec['enum']] if 'enum' in spec else None
+
+        if self.enum is None and self.width != 1:
+            raise SchemaError(f'{self.name}: multi-bit fields need an enum')
+        if self.shift + self.width > word * 8:
+            raise SchemaError(f'{self.name}: outside of its word')
+
+
+class Field:
+    def __init__(self, spec, table, enums):
+        self.name = spec['name']
+        self.kind = spec['kind']
+        self.offset = number(spec['offset'])
+        self.since = spec.get('since', table.since)
+        self.brief = spec['brief']
+        self.details = spec.get('details', [])
+        self.label = spec.get('label', self.name)
+        self.unit = spec.get('unit', '')
+        self.enum = None
+        self.bits = []
+
+        if self.kind in SCALARS:
+            self.c_type, self.size = SCALARS[self.kind]
+        elif self.kind == 'enum':
+            self.enum = enums[spec['enum']]
+            self.c_type, self.size = self.enum.c_type, 1
+        elif self.kind == 'bytes':
+            self.c_type, self.size = 'uint8_t', number(spec['size'])
+        elif self.kind == 'bits':
+            self.size = number(spec.get('size', 1))
+            self.c_type = WORDS[self.size]
+            self.bits = [Bits(bits, self.size, enums) for bits in spec['bits']]
+        else:
+            raise SchemaError(f'{table.name}.{self.name}: unknown kind {self.kind}')
+
+        if self.offset < HEADER_SIZE:
+            raise SchemaError(f'{table.name}.{self.name}: overlaps the header')
+        if len(self.label) > 0xFF:
+            raise SchemaError(f'{table.name}.{self.name}: label too long')
+
+        # Trailing fields the structure may end before, even in tables
+        # implementing their version.
+        self.trailing = spec.get('optional', False)
+
+        # Fields of the first version of the structure are always there,
+        # others only in tables implementing their version and long enough.
+        self.optional = self.trailing or version_key(self.since) > version_key(table.since)
+
+    @property
+    def end(self):
+        return self.offset + self.size
+
+    def accessors(self):
+        '''Decodable values: the bit fields of a word, or the field itself.'''
+        return [(bits.name, bits) for bits in self.bits] if self.bits else [(self.name, None)]
+
+
+class Table:
+    def __init__(self, spec, enums):
+        self.type = spec['type']
+        self.name = spec['name']
+        self.header = spec['header']
+        self.title = spec['title']
+        self.brief = spec['brief']
+        self.since = spec['since']
+        self.variable = spec.get('variable')
+        self.includes = []
+        self.enums = []
+
+        for enum in spec.get('enums', []):
+            if enum['name'] in enums:
+                raise SchemaError(f'{enum["name"]}: declared twice')
+            enums[enum['name']] = Enum(enum, self)
+            if 'extern' in enum:
+                if enum['extern'] not in self.includes:
+                    self.includes.append(enum['extern'])
+            else:
+                self.enums.append(enums[enum['name']])
+
+        self.fields = [Field(field, self, enums) for field in spec['fields']]
+        self.check()
+
+        for field in self.fields:
+            for enum in [field.enum] + [bits.enum for bits in field.bits]:
+                if enum is None or (enum.owner is self and not enum.extern):
+                    continue
+                header = enum.extern or enum.owner.include
+                if header not in self.includes:
+                    self.includes.append(header)
+
+    @property
+    def include(self):
+        return f'dmi/table/generated/{self.header}.h'
+
+    @property
+    def c_table(self):
+        return f'dmi_{self.name}_table'
+
+    @property
+    def accessors(self):
+        return [(name, field, bits) for field in self.fields for name, bits in field.accessors()]
+
+    @property
+    def versions(self):
+        return sorted({field.since for field in self.fields}, key=version_key)
+
+    def check(self):
+        offset = HEADER_SIZE
+        names = set()
+
+        for field in self.fields:
+            if field.offset < offset:
+                raise SchemaError(f'{self.name}.{field.name}: overlaps the previous field')
+            offset = field.end
+
+            for name, _ in field.accessors():
+                if name in names or name in ('handle', 'structure', 'fields', 'base', 'has', 'materialize'):
+                    raise SchemaError(f'{self.name}.{name}: name already used')
+                names.add(name)
+
+        for since in {field.since for field in self.fields}:
+            if version_key(since) < version_key(self.since):
+                raise SchemaError(f'{self.name}: field older than the structure')
+
+    def layout(self):
+        out = comment([f'@brief {self.title} structure (type {self.type}).', '', '@details',
+                       *self.brief] + (['', *self.variable] if self.variable else []), 0)
+        out.append(f'struct {self.c_table}')
+        out.append('{')
+        out += comment(['@brief DMI structure header.'], 4)
+        out.append('    dmi_header_t header;')
+
+        offset = HEADER_SIZE
+        for field in self.fields:
+            if field.offset > offset:
+                out.append('')
+                out.append(f'    uint8_t __reserved_{offset:02x}[{field.offset - offset}];')
+            offset = field.end
+
+            out.append('')
+            if field.bits:
+                bit = 0
+                for bits in sorted(field.bits, key=lambda bits: bits.shift):
+                    if bits.shift > bit:
+                        out.append(f'    {field.c_type} : {bits.shift - bit};')
+                    out += comment([f'@brief {bits.brief}', '', f'@since SMBIOS {field.since}'], 4)
+                    c_type = bits.enum.c_type if bits.enum else field.c_type
+                    out.append(f'    {c_type} {bits.name} : {bits.width};')
+                    bit = bits.shift + bits.width
+                    if bits is not field.bits[-1]:
+                        out.append('')
+                if bit < field.size * 8:
+                    out.append(f'    {field.c_type} : {field.size * 8 - bit};')
+                continue
+
+            lines = [f'@brief {field.brief}']
+            if field.kind == 'string':
+                lines.append('')
+                lines.append('@details')
+                lines.append('Number of the string, 0 if there is none.')
+            if field.details:
+                lines += ([] if field.kind == 'string' else ['', '@details']) + field.details
+            lines += ['', f'@since SMBIOS {field.since}']
+            out += comment(lines, 4)
+
+            suffix = f'[{field.size}]' if field.kind == 'bytes' else ''
+            out.append(f'    {field.c_type} {field.name}{suffix};')
+
+        out.append('} __attribute__((packed));')
+        out.append('')
+
+        for field in self.fields:
+            if not field.bits:
+                out.append(f'static_assert(offsetof({self.c_table}, {field.name}) == 0x{field.offset:02X});')
+        out.append(f'static_assert(sizeof({self.c_table}) == 0x{self.fields[-1].end:02X});')
+        return out
+
+    def length(self):
+        out = comment([f'@brief Length of the {self.title.lower()} structure guaranteed by SMBIOS @p version.'], 4)
+        out.append(f'    constexpr size_t {self.name}_length(const version_id& version) noexcept')
+        out.append('    {')
+
+        for since in reversed(self.versions):
+            required = [field for field in self.fields
+                        if version_key(field.since) <= version_key(since) and not field.trailing]
+            end = max((field.end for field in required), default=HEADER_SIZE)
+            out.append(f'        if (version >= {version(since)})')
+            out.append(f'            return 0x{end:02X};')
+
+        out.append('')
+        out.append('        return sizeof(dmi_header_t);')
+        out.append('    }')
+        return out
+
+    def value_type(self, field, bits):
+        if bits is not None:
+            if bits.enum is not None:
+                return f'dmi::table::{bits.enum.name}'
+            return 'bool'
+        if field.kind == 'enum':
+            return f'dmi::table::{field.enum.name}'
+        if field.kind == 'handle':
+            return 'handle_t'
+        return field.c_type
+
+    def view_type(self, field, bits):
+        if field.kind == 'string':
+            return 'std::optional<std::string_view>'
+        if field.kind == 'handle':
+            return 'std::optional<handle_t>'
+        if field.kind == 'bytes':
+            return f'std::optional<std::span<const std::byte, {field.size}>>'
+
+        value = self.value_type(field, bits)
+        return f'std::optional<{value}>' if field.optional else value
+
+    def owned_type(self, field, bits):
+        if field.kind == 'string':
+            return 'std::optional<String>'
+        if field.kind == 'bytes':
+            return f'std::optional<std::array<std::byte, {field.size}>>'
+        return self.view_type(field, bits)
+
+    def field_enum(self):
+        accessors = self.accessors
+        count = len(accessors)
+        word = next(bits for bits in (8, 16, 32, 64) if count < bits)
+        one = '1ull' if word == 64 else '1'
+
+        out = comment([f'@brief {self.title} fields, for use with dmi::decode().'], 4)
+        out.append(f'    enum class {self.name}_field : uint{word}_t')
+        out.append('    {')
+        rows = [(name, f'= {one} << {index},') for index, (name, _, _) in enumerate(accessors)]
+        rows.append(('all', f'= 0x{(1 << count) - 1:X}'))
+        out += align(rows, 8)
+        out.append('    };')
+        out.append('')
+        out.append(f'    DMI_FIELD_MASK({self.name}_field)')
+        return out
+
+    def view(self):
+        name = self.name
+        strings = [field for field in self.fields if field.kind == 'string']
+
+        out = comment([f'@brief {self.title} view.', '', '@details',
+                       f'Zero-copy view of a {self.title.lower()} structure, tied to the lifetime of',
+                       'the context it was obtained from.', '',
+                       'Fields that SMBIOS @p Min guarantees are read without a length check,',
+                       'the structure must be at least @ref min_length bytes long.'], 4)
+        out += [
+            '    template <version_id Min = smbios_any>',
+            f'    class basic_{name}_view',
+            '    {',
+            '    private:',
+            '        dmi::structure m_structure;',
+            '',
+            '    public:',
+            '        static constexpr version_id min_version = Min;',
+            f'        static constexpr size_t min_length = {name}_length(Min);',
+            '',
+        ]
+        out += comment(['@brief Offsets of the string number fields.'], 8)
+        offsets = ', '.join(f'offsetof({self.c_table}, {field.name})' for field in strings)
+        out.append(f'        static constexpr std::array<size_t, {len(strings)}> string_fields = {{ {offsets} }};'
+                   if strings else '        static constexpr std::array<size_t, 0> string_fields = {};')
+        out.append('')
+        out += comment([f'@param structure {self.title} structure.'], 8)
+        out += [
+            f'        constexpr explicit basic_{name}_view(const dmi::structure& structure)',
+            '            : m_structure(structure)',
+            '        {',
+            '        }',
+            '',
+            '        constexpr handle_t handle() const { return m_structure.handle(); }',
+            '        constexpr const dmi::structure& structure() const { return m_structure; }',
+        ]
+
+        for field in self.fields:
+            if field.bits:
+                for bits in field.bits:
+                    out.append('')
+                    out += self.bits_accessor(field, bits)
+            else:
+                out.append('')
+                out += self.accessor(field)
+
+        out += [
+            '',
+        ]
+        out += comment(['@brief Makes an owning copy of the structure.'], 8)
+        out += [
+            f'        {name} materialize() const;',
+            '',
+            '    private:',
+            '        constexpr const std::byte *base() const',
+            '        {',
+            '            return m_structure.data().data();',
+            '        }',
+        ]
+
+        for field in self.fields:
+            if field.bits:
+                out.append('')
+                out += self.word_accessor(field)
+
+        out += [
+            '',
+            '        constexpr bool has(size_t offset, size_t size) const',
+            '        {',
+            '            return offset + size <= min_length || m_structure.covers(offset, size);',
+            '        }',
+            '    };',
+            '',
+            f'    using {name}_view = basic_{name}_view<>;',
+        ]
+        return out
+
+    def accessor(self, field):
+        offset = f'offsetof({self.c_table}, {field.name})'
+        load = f'DMI_FIELD(base(), {self.c_table}, {field.name})'
+        result = self.view_type(field, None)
+
+        if field.kind == 'string':
+            return [
+                f'        inline {result} {field.name}() const',
+                '        {',
+                f'            if (!has({offset}, 1))',
+                '                return std::nullopt;',
+                '',
+                f'            uint8_t index = {load};',
+                '            if (index == 0)',
+                '                return std::nullopt;',
+                '',
+                '            return m_structure.string(index);',
+                '        }',
+            ]
+
+        if field.kind == 'handle':
+            return [
+                f'        constexpr {result} {field.name}() const',
+                '        {',
+                f'            if (!has({offset}, sizeof(handle_t)))',
+                '                return std::nullopt;',
+                '',
+                f'            handle_t handle = {load};',
+                '            if (handle == 0xFFFF)',
+                '                return std::nullopt;',
+                '',
+                '            return handle;',
+                '        }',
+            ]
+
+        if field.kind == 'bytes':
+            return [
+                f'        constexpr {result} {field.name}() const',
+                '        {',
+                f'            if (!has({offset}, {field.size}))',
+                '                return std::nullopt;',
+                '',
+                f'            return std::span<const std::byte, {field.size}>(base() + {offset}, {field.size});',
+                '        }',
+            ]
+
+        value = self.value_type(field, None)
+        empty = 'std::nullopt' if field.optional else f'{value}{{}}' if field.enum else '0'
+        size = 1 if field.enum else f'sizeof({field.c_type})'
+        load = f'{value}({load})' if field.enum else load
+
+        return [
+            f'        constexpr {result} {field.name}() const',
+            '        {',
+            f'            if (!has({offset}, {size}))',
+            f'                return {empty};',
+            '',
+            f'            return {load};',
+            '        }',
+        ]
+
+    def bits_accessor(self, field, bits):
+        result = self.view_type(field, bits)
+        value = self.value_type(field, bits)
+
+        def extract(word):
+            if bits.enum is None:
+                return f'dmi::flag<{bits.shift}>({word})'
+            return f'{value}(dmi::bits<{bits.shift}, {bits.width}>({word}))'
+
+        if not field.optional:
+            return [
+                f'        constexpr {result} {bits.name}() const',
+                '        {',
+                f'            return {extract(f"{field.name}()")};',
+                '        }',
+            ]
+
+        return [
+            f'        constexpr {result} {bits.name}() const',
+            '        {',
+            f'            auto word = {field.name}();',
+            '            if (!word)',
+            '                return std::nullopt;',
+            '',
+            f'            return {extract("*word")};',
+            '        }',
+        ]
+
+    def word_accessor(self, field):
+        result = f'std::optional<{field.c_type}>' if field.optional else field.c_type
+        empty = 'std::nullopt' if field.optional else '0'
+
+        out = comment([f'@brief {field.brief}'], 8)
+        out += [
+            f'        constexpr {result} {field.name}() const',
+            '        {',
+            f'            constexpr size_t offset = 0x{field.offset:02X};',
+            '',
+            f'            if (!has(offset, sizeof({field.c_type})))',
+            f'                return {empty};',
+            '',
+            f'            return load<{field.c_type}>(base() + offset);',
+            '        }',
+        ]
+        return out
+
+    def decoded(self):
+        name = self.name
+        accessors = self.accessors
+        versions = ', '.join(['smbios_any'] + [version(since) for since in self.versions])
+
+        out = ['    template <typename String>',
+               f'    class basic_{name} : public dmi::basic_table', '    {', '    private:']
+        rows = [(self.owned_type(field, bits), f'm_{accessor};') for accessor, field, bits in accessors]
+        rows.append((f'{name}_field', 'm_fields;'))
+        out += [f'        {type_} {member}' for type_, member in rows]
+
+        out += [
+            '',
+            '    public:',
+            f'        static constexpr dmi::table_type structure_type = table_type::{name};',
+            '',
+            f'        using view_type = {name}_view;',
+            f'        using field_type = {name}_field;',
+            '',
+            '        template <version_id Min>',
+            f'        using view_at = basic_{name}_view<Min>;',
+            '',
+        ]
+        out += comment(['@brief Versions at which fields were added.'], 8)
+        out.append(f'        static constexpr std::array versions = {{ {versions} }};')
+        out.append('')
+        out += comment(['@brief Decodes the @p fields of @p view.', '', '@details',
+                        'Fields that are not selected are left empty (or zero). Strings',
+                        'are kept as @p strings returns them.'], 8)
+        out += [
+            '        template <version_id Min, typename Strings = dmi::detail::copy_strings>',
+            f'        explicit basic_{name}(const basic_{name}_view<Min>& view,',
+            f'            {name}_field fields = {name}_field::all, Strings&& strings = {{}})',
+            '            : basic_table(view.handle()),',
+        ]
+        for accessor, field, bits in accessors:
+            if not self.owned_type(field, bits).startswith('std::optional'):
+                out.append(f'              m_{accessor}{{}},')
+        out.append('              m_fields(fields)')
+        out.append('        {')
+
+        for accessor, field, bits in accessors:
+            out.append(f'            if (has_field(fields, {name}_field::{accessor}))')
+            if field.kind == 'bytes':
+                out[-1] += ' {'
+                out += [
+                    f'                if (auto bytes = view.{accessor}())',
+                    f'                    std::ranges::copy(*bytes, m_{accessor}.emplace().begin());',
+                    '            }',
+                ]
+            elif field.kind == 'string':
+                out.append(f'                m_{accessor} = strings(view.{accessor}());')
+            else:
+                out.append(f'                m_{accessor} = view.{accessor}();')
+
+        out += ['        }', '']
+        out += comment(['@brief Fields that were decoded.'], 8)
+        out.append(f'        inline {name}_field fields() const {{ return m_fields; }}')
+        out.append('')
+
+        for accessor, field, bits in accessors:
+            type_ = self.owned_type(field, bits)
+            if type_.startswith('std::'):
+                out.append(f'        inline const {type_}& {accessor}() const {{ return m_{accessor}; }}')
+            else:
+                out.append(f'        inline {type_} {accessor}() const {{ return m_{accessor}; }}')
+
+        out += [
+            '    };',
+            '',
+            '    template <version_id Min>',
+            f'    inline {name} basic_{name}_view<Min>::materialize() const',
+            '    {',
+            f'        return {name}(*this);',
+            '    }',
+        ]
+        return out
+
+    def generate(self):
+        guard = f'DMI_TABLE_GENERATED_{self.header.upper().replace("-", "_")}_H'
+        out = LICENSE.splitlines() + [f'#ifndef {guard}', f'#define {guard}', '', '#pragma once', '']
+        out += [f'#include <{header}>' for header in
+                ('dmi/table.h', 'dmi/enum.h', 'dmi/decode.h', 'dmi/field.h', 'dmi/structure.h', 'dmi/version.h')]
+        out += [f'#include <{header}>' for header in self.includes]
+        out.append('')
+        out += [f'#include <{header}>' for header in
+                ('algorithm', 'array', 'cstddef', 'optional', 'span', 'string', 'string_view')]
+        out.append('')
+
+        for enum in self.enums:
+            out += enum.c_declaration()
+            out.append('')
+
+        out += self.layout()
+        out.append('')
+
+        if self.enums:
+            out.append('__BEGIN_DECLS')
+            out.append('')
+            out += [f'const char *{enum.c_name}_str({enum.c_type} value);' for enum in self.enums]
+            out.append('')
+            out.append('__END_DECLS')
+            out.append('')
+
+        out += ['#ifdef __cplusplus', '', 'namespace dmi::table', '{']
+
+        for enum in self.enums:
+            out += enum.cxx_declaration()
+            out.append('')
+
+        if self.enums:
+            out.append('    namespace detail')
+            out.append('    {')
+            for enum in self.enums:
+                out += enum.names()
+                if enum is not self.enums[-1]:
+                    out.append('')
+            out.append('    }')
+            out.append('')
+            for enum in self.enums:
+                out += enum.functions()
+
+        out += self.field_enum()
+        out.append('')
+        out += [
+            '    template <typename String>',
+            f'    class basic_{self.name};',
+            '',
+            f'    using {self.name} = basic_{self.name}<std::string>;',
+            f'    using {self.name}_record = basic_{self.name}<dmi::string_ref>;',
+        ]
+        out.append('')
+        out += self.length()
+        out.append('')
+        out += self.view()
+        out.append('')
+        out += self.decoded()
+        out += ['}', '', '#endif // __cplusplus', '', f'#endif // !{guard}', '']
+        return '\n'.join(out)
+
+
+def load(path):
+    schema = json.loads(Path(path).read_text())
+    enums = {}
+    tables = [Table(spec, enums) for spec in schema['tables']]
+
+    if len({table.type for table in tables}) != len(tables):
+        raise SchemaError('structure type described twice')
+
+    return schema.get('handwritten', []), tables
+
+
+def select(handwritten, tables, names):
+    known = handwritten + [table.name for table in tables]
+    if names is None:
+        return known
+
+    for name in names:
+        if name not in known:
+            raise SchemaError(f'unknown table {name}')
+
+    return [name for name in known if name in names]
+
+
+def tables_header(tables, enabled):
+    guard = 'DMI_TABLE_GENERATED_TABLES_H'
+    out = LICENSE.splitlines() + [f'#ifndef {guard}', f'#define {guard}', '', '#pragma once', '']
+    out += [f'#include <{table.include}>' for table in tables]
+    out.append('')
+    out += comment(['@brief Calls @p X with the name of every generated table.', '', '@details',
+                    'The name is that of the table_type value, of the decoded class and',
+                    'of its view, length function and packed C structure.'], 0)
+    rows = [(f'#define DMI_GENERATED_TABLES(X)', '\\')]
+    rows += [(f'    X({table.name})', '\\') for table in tables]
+    rows[-1] = (rows[-1][0], '')
+    out += align(rows, 0)
+    out.append('')
+    out += comment(['@brief Calls @p X with the name of every table compiled in.', '', '@details',
+                    'Generated and hand-written tables alike, as selected with the',
+                    '`DMI_TABLES` build option.'], 0)
+    if enabled:
+        rows = [(f'#define DMI_ENABLED_TABLES(X)', '\\')]
+        rows += [(f'    X({name})', '\\') for name in enabled]
+        rows[-1] = (rows[-1][0], '')
+        out += align(rows, 0)
+    else:
+        out.append('#define DMI_ENABLED_TABLES(X)')
+    out.append('')
+    out += comment(['@brief Table types compiled in, as a comma-separated list.'], 0)
+    if enabled:
+        rows = [('#define DMI_ENABLED_TABLE_TYPES', '\\')]
+        rows += [(f'    dmi::table_type::{name},', '\\') for name in enabled]
+        rows[-1] = (rows[-1][0].rstrip(','), '')
+        out += align(rows, 0)
+    else:
+        out.append('#define DMI_ENABLED_TABLE_TYPES')
+    out += ['', f'#endif // !{guard}', '']
+    return '\n'.join(out)
+
+
+def text_table(table):
+    '''Fields dmidecode prints for table, for source::import_text().'''
+    fields = [field for field in table.fields if field.kind in TEXT_KINDS]
+    if not fields:
+        return []
+
+    enums = []
+    labels = []
+    rows = []
+    offset = 0
+
+    for field in fields:
+        enum = 0
+        if field.enum is not None:
+            if field.enum not in enums:
+                enums.append(field.enum)
+            enum = enums.index(field.enum)
+
+        labels.append(f'        {c_string(field.label)[:-1]}\\0" {c_string(field.unit)[:-1]}\\0"')
+        rows.append(f'{{ 0x{offset:04X}, {len(field.label)}, 0x{field.offset:02X}, {field.size}, '
+                    f'dmi::detail::text_kind::{TEXT_KINDS[field.kind]}, {enum} }},')
+        offset += len(field.label) + len(field.unit) + 2
+
+    labels[-1] += ';'
+    rows[-1] = rows[-1].rstrip(',')
+
+    out = [f'    constexpr char {table.name}_labels[] =']
+    out += labels
+    out.append('')
+    out.append(f'    constexpr dmi::detail::text_field {table.name}_text_fields[] = {{')
+    out += [f'        {row}' for row in rows]
+    out.append('    };')
+    out.append('')
+
+    if enums:
+        out += [
+            f'    std::optional<unsigned> {table.name}_text_enum(unsigned enumeration, std::string_view name) noexcept',
+            '    {',
+            '        switch (enumeration) {',
+        ]
+        for index, enum in enumerate(enums):
+            out += [
+                f'        case {index}:',
+                f'            return dmi::detail::find_name<dmi::table::{enum.name}>(name);',
+            ]
+        out += ['        default:', '            return std::nullopt;', '        }', '    }', '']
+
+    return out
+
+
+def names_source(tables, enabled):
+    out = LICENSE.splitlines() + ['#include <dmi/import.h>', '#include <dmi/table/generated/tables.h>', '']
+    enabled_tables = [table for table in tables if table.name in enabled]
+
+    for table in enabled_tables:
+        for enum in table.enums:
+            out += [
+                f'const char *{enum.c_name}_str({enum.c_type} value)',
+                '{',
+                f'    return dmi::detail::c_name(dmi::table::detail::{enum.name}_names, value);',
+                '}',
+                '',
+            ]
+
+    texts = [(table, text_table(table)) for table in enabled_tables]
+    texts = [(table, text) for table, text in texts if text]
+
+    if texts:
+        out += ['namespace', '{']
+        for _, text in texts:
+            out += text
+        out[-1:] = ['}', '']
+
+    out += [
+        'auto dmi::detail::generated_text_table(table_type type) noexcept -> text_table',
+        '{',
+    ]
+    if texts:
+        out.append('    switch (type) {')
+        for table, text in texts:
+            lookup = f'{table.name}_text_enum' if any('_text_enum' in line for line in text) else 'nullptr'
+            out += [
+                f'    case table_type::{table.name}:',
+                f'        return {{ {table.name}_text_fields, {table.name}_labels, {lookup} }};',
+            ]
+        out += ['    default:', '        return {};', '    }']
+    else:
+        out += ['    (void)type;', '    return {};']
+    out += ['}', '']
+
+    return '\n'.join(out)
+
+
+def outputs(tables, enabled, root):
+    files = {root / 'include' / table.include: table.generate for table in tables}
+    files[root / 'include/dmi/table/generated/tables.h'] = lambda: tables_header(tables, enabled)
+    files[root / 'src/table/generated.cc'] = lambda: names_source(tables, enabled)
+    return files
+
+
+def main(argv):
+    listing = argv[1:2] == ['--list']
+    if listing:
+        argv = argv[1:]
+
+    names = None
+    if argv[1:2] and argv[1].startswith('--tables='):
+        names = [name for name in argv[1][len('--tables='):].split(',') if name]
+        argv = argv[1:]
+
+    if len(argv) != 3:
+        print(f'usage: {argv[0]} [--list | --tables=<name>,...] <schema.json> <output directory>',
+              file=sys.stderr)
+        return 2
+
+    try:
+        handwritten, tables = load(argv[1])
+        enabled = select(handwritten, tables, names)
+    except (SchemaError, KeyError, ValueError) as e:
+        print(f'{argv[1]}: {e}', file=sys.stderr)
+        return 1
+
+    files = outputs(tables, enabled, Path(argv[2]))
+
+    if listing:
+        print(';'.join(str(path) for path in files))
+        return 0
+
+    for path, generate in files.items():
+        text = generate()
+        if path.exists() and path.read_text() == text:
+            continue
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(text)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
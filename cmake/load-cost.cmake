@@ -0,0 +1,42 @@
+#
+# SPDX-License-Identifier: MIT
+# SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+#
+# Checks that loading LIBRARY runs no code of the library and patches next
+# to no data: no global constructors, and at most MAX_RELOCATIONS dynamic
+# relocations besides the PLT and GOT ones.
+#
+#   cmake -DLIBRARY=<path> -DREADELF=<path> [-DMAX_RELOCATIONS=<n>] -P load-cost.cmake
+#
+if(NOT DEFINED MAX_RELOCATIONS)
+    set(MAX_RELOCATIONS 16)
+endif()
+
+execute_process(
+    COMMAND ${READELF} -W --dyn-syms --syms ${LIBRARY}
+    OUTPUT_VARIABLE symbols
+    COMMAND_ERROR_IS_FATAL ANY)
+
+# Dynamic initializers of namespace-scope objects, and the libgcc CPU model
+# constructor pulled in by __builtin_cpu_supports().
+string(REGEX MATCHALL "_GLOBAL__sub_I[A-Za-z0-9_.]*|__cpu_indicator_init" constructors "${symbols}")
+if(constructors)
+    list(REMOVE_DUPLICATES constructors)
+    message(FATAL_ERROR "${LIBRARY}: global constructors: ${constructors}")
+endif()
+
+execute_process(
+    COMMAND ${READELF} -W --relocs ${LIBRARY}
+    OUTPUT_VARIABLE relocations
+    COMMAND_ERROR_IS_FATAL ANY)
+
+# Types only: mangled symbol names may hold `R_` too.
+string(REGEX MATCHALL " R_[A-Z0-9_]+ " types "${relocations}")
+list(FILTER types EXCLUDE REGEX "_(JUMP_SLOT|GLOB_DAT) $")
+list(LENGTH types count)
+
+if(count GREATER MAX_RELOCATIONS)
+    message(FATAL_ERROR "${LIBRARY}: ${count} data relocations, expected at most ${MAX_RELOCATIONS}")
+endif()
+
+message(STATUS "${LIBRARY}: no global constructors, ${count} data relocations")
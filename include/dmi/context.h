@@ -7,15 +7,228 @@
 
 #pragma once
 
+#include <initializer_list>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+
 #include <dmi/types.h>
+#include <dmi/decode.h>
+#include <dmi/directory.h>
+#include <dmi/snapshot.h>
+#include <dmi/source.h>
+#include <dmi/structure.h>
+#include <dmi/traits.h>
+#include <dmi/version.h>
 
 namespace dmi
 {
+    /**
+     * @brief SMBIOS context.
+     *
+     * @details
+     * Holds the raw SMBIOS data of a system and a directory of its
+     * structures, built once when the context is created. Everything
+     * obtained from a context points into its buffer and must not outlive
+     * it, see detach() for a copy that does not depend on the source.
+     *
+     * The directory and the decoded tables are allocated from an arena
+     * owned by the context and released all at once with it.
+     */
     class context
     {
+    private:
+        std::pmr::monotonic_buffer_resource m_arena;
+        dmi::source m_source;
+        dmi::directory m_directory;
+        version_id m_version;
+        mutable detail::table_store m_tables;
+
     public:
+        /**
+         * @brief Opens the SMBIOS data of the running system.
+         *
+         * @throws std::system_error
+         */
         context();
+
+        /**
+         * @brief Opens the SMBIOS data from the sysfs tree under @p root.
+         *
+         * @throws std::invalid_argument
+         * @throws std::system_error
+         */
+        explicit context(std::string_view root);
+
+        /**
+         * @brief Opens the structures of @p types only, from the sysfs tree
+         * under @p root.
+         *
+         * @details
+         * Reads each structure from its own file, see
+         * source::open_entries(), instead of reading and indexing the
+         * whole table: the context only knows about @p types. Without an
+         * entry point the SMBIOS version is unknown (dmi::smbios_any), so
+         * tables are decoded with length-checked views.
+         *
+         * @code
+         * dmi::context ctx({ dmi::table_type::system, dmi::table_type::chassis });
+         * @endcode
+         *
+         * @throws std::invalid_argument
+         * @throws std::system_error
+         */
+        explicit context(std::span<const table_type> types,
+            std::string_view root = DMI_SYSFS_ROOT);
+
+        explicit context(std::initializer_list<table_type> types,
+            std::string_view root = DMI_SYSFS_ROOT)
+            : context(std::span<const table_type>(types.begin(), types.size()), root)
+        {
+        }
+
+        /**
+         * @brief Takes over an already loaded SMBIOS data source.
+         *
+         * @details
+         * Loading the source with source::try_open() lets errors be handled
+         * without exceptions.
+         */
+        explicit context(dmi::source&& source);
+
         virtual ~context();
+
+        inline auto entry_point() const -> std::span<const std::byte>
+        {
+            return m_source.entry_point();
+        }
+
+        inline auto table() const -> std::span<const std::byte>
+        {
+            return m_source.table();
+        }
+
+        /**
+         * @brief SMBIOS version implemented by the table.
+         *
+         * @details
+         * Zero (dmi::smbios_any) if the entry point could not be parsed.
+         */
+        inline const version_id& version() const { return m_version; }
+
+        /**
+         * @brief Range of the structures in the table.
+         */
+        inline structure_range structures() const
+        {
+            return structure_range(m_source.table());
+        }
+
+        /**
+         * @brief Directory of the structures in the table.
+         */
+        inline const dmi::directory& index() const { return m_directory; }
+
+        /**
+         * @brief Checks whether the table has structures of @p type.
+         */
+        inline bool contains(table_type type) const
+        {
+            return m_directory.contains(type);
+        }
+
+        /**
+         * @brief Range of structures of @p type, in table order.
+         */
+        inline auto find(table_type type) const
+        {
+            return m_directory.find(type);
+        }
+
+        /**
+         * @brief Copies the SMBIOS data and the directory into a snapshot
+         * that does not depend on the source.
+         *
+         * @details
+         * The snapshot is a single relocatable allocation: it can outlive
+         * the context and the memory the source was loaded from, and be
+         * copied or sent across threads as a block of bytes.
+         */
+        dmi::snapshot detach() const;
+
+        /**
+         * @brief Finds the structure with @p handle.
+         */
+        inline std::optional<structure> find(handle_t handle) const
+        {
+            return m_directory.find(handle);
+        }
+
+        /**
+         * @brief Range of the typed views of the structures of @p Type, in
+         * table order.
+         *
+         * @details
+         * Structures shorter than the view's minimum length are skipped.
+         *
+         * @code
+         * for (auto cache : ctx.get<dmi::table_type::cache>())
+         *     std::println("{}", cache.socket_designation());
+         * @endcode
+         */
+        template <table_type Type>
+            requires registered_table<Type>
+        inline auto get() const
+        {
+            using view = typename table_traits<Type>::view_type;
+
+            return m_directory.indices(uint8_t(Type))
+                | std::views::filter([this](uint32_t index) {
+                      return m_directory.records()[index].length >= view::min_length;
+                  })
+                | std::views::transform([this](uint32_t index) {
+                      return view(m_directory.at(index));
+                  });
+        }
+
+        /**
+         * @brief Decoded tables of @p Type, in table order.
+         *
+         * @details
+         * Tables are decoded once, on first access (safe to race from
+         * several threads), into a single contiguous vector of trivially
+         * destructible records per type that lives as long as the context.
+         * Their strings are offsets into a blob of the same lifetime,
+         * resolved with stored_tables::string(). Structures shorter than
+         * the view's minimum length are skipped, as with get().
+         *
+         * @code
+         * auto systems = context.tables<dmi::table_type::system>();
+         * for (const auto& system : systems)
+         *     std::println("{}", systems.string(system.product()));
+         * @endcode
+         */
+        template <table_type Type>
+            requires registered_table<Type>
+        inline auto tables() const -> stored_tables<typename table_traits<Type>::record_type>
+        {
+            using record = typename table_traits<Type>::record_type;
+            using view = typename table_traits<Type>::view_type;
+
+            return m_tables.get<Type>([this](std::pmr::vector<record>& tables, detail::blob_strings strings) {
+                auto indices = m_directory.indices(uint8_t(Type));
+                tables.reserve(indices.size());
+
+                for (uint32_t index : indices) {
+                    auto structure = m_directory.at(index);
+                    if (structure.length() >= view::min_length)
+                        tables.push_back(detail::decode_at<record, std::size(record::versions) - 1>(
+                            structure, m_version, record::field_type::all, strings));
+                }
+            });
+        }
     };
 }
 
@@ -0,0 +1,179 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_DECODE_H
+#define DMI_DECODE_H
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <dmi/structure.h>
+#include <dmi/version.h>
+
+/**
+ * @brief Defines the bitwise operators of the field mask enum @p E.
+ *
+ * @details
+ * Must be used in the namespace of @p E so that the operators are found by
+ * argument-dependent lookup.
+ */
+#define DMI_FIELD_MASK(E)                                                  \
+    constexpr E operator|(E lhs, E rhs) noexcept                           \
+    {                                                                      \
+        return E(std::to_underlying(lhs) | std::to_underlying(rhs));       \
+    }                                                                      \
+    constexpr E operator&(E lhs, E rhs) noexcept                           \
+    {                                                                      \
+        return E(std::to_underlying(lhs) & std::to_underlying(rhs));       \
+    }                                                                      \
+    constexpr E operator~(E value) noexcept                                \
+    {                                                                      \
+        return E(~std::to_underlying(value) & std::to_underlying(E::all)); \
+    }
+
+namespace dmi
+{
+    /**
+     * @brief Checks whether @p field is selected in @p fields.
+     */
+    template <typename E>
+        requires std::is_enum_v<E>
+    constexpr bool has_field(E fields, E field) noexcept
+    {
+        return (std::to_underlying(fields) & std::to_underlying(field)) != 0;
+    }
+
+    /**
+     * @brief Owning table class decodable from a view.
+     *
+     * @details
+     * The class names its view with `view_type` and its field mask with
+     * `field_type`, and is constructible from both.
+     */
+    template <typename T>
+    concept decodable = requires {
+        typename T::view_type;
+        typename T::field_type;
+        { T::field_type::all } -> std::convertible_to<typename T::field_type>;
+    } && std::constructible_from<T, const typename T::view_type&, typename T::field_type>;
+
+    /**
+     * @brief Decodable table whose views are gated on an SMBIOS version.
+     *
+     * @details
+     * `view_at<Min>` is a view that reads the fields SMBIOS `Min` guarantees
+     * without checking the structure length, and `versions` lists, in
+     * ascending order, the versions at which the structure grew.
+     */
+    template <typename T>
+    concept version_gated = decodable<T> && requires {
+        typename T::template view_at<smbios_any>;
+        { T::versions[0] } -> std::convertible_to<version_id>;
+    };
+
+    /**
+     * @brief View of a structure the table @p T can be decoded from.
+     */
+    template <typename V, typename T>
+    concept view_of = !std::same_as<V, structure> &&
+        std::constructible_from<T, const V&, typename T::field_type>;
+
+    namespace detail
+    {
+        template <typename T, size_t Index, typename Strings = copy_strings>
+        inline T decode_at(const structure& structure, const version_id& version,
+            typename T::field_type fields, Strings&& strings = {})
+        {
+            constexpr version_id min = T::versions[Index];
+            using view = typename T::template view_at<min>;
+
+            if constexpr (Index == 0) {
+                return T(view(structure), fields, strings);
+            } else {
+                if (version >= min && structure.length() >= view::min_length)
+                    return T(view(structure), fields, strings);
+
+                return decode_at<T, Index - 1>(structure, version, fields, strings);
+            }
+        }
+    }
+
+    /**
+     * @brief Decodes the @p fields of @p view.
+     *
+     * @details
+     * Fields that are not selected are left empty (or zero) and their bytes
+     * and strings are never read. Decoders are inline, so with a constant
+     * mask the code for unselected fields is removed altogether.
+     *
+     * @code
+     * auto sys = dmi::decode<dmi::table::system>(view,
+     *     dmi::table::system_field::uuid | dmi::table::system_field::serial_number);
+     * @endcode
+     */
+    template <decodable T, view_of<T> V>
+    inline T decode(const V& view, typename T::field_type fields = T::field_type::all)
+    {
+        return T(view, fields);
+    }
+
+    template <decodable T>
+    inline T decode(const structure& structure,
+        typename T::field_type fields = T::field_type::all)
+    {
+        return T(typename T::view_type(structure), fields);
+    }
+
+    /**
+     * @brief Decodes the @p fields of @p structure from a table implementing
+     * SMBIOS @p version.
+     *
+     * @details
+     * Picks, once per structure, the view gated on the newest version that
+     * both @p version and the structure length satisfy, so that the fields
+     * this version guarantees are decoded without length checks. Structures
+     * shorter than their version requires fall back to a checked view.
+     *
+     * When every table is known to implement some version, a view gated on
+     * it can be passed to decode() directly instead, e.g.
+     * `dmi::table::basic_system_view<dmi::smbios_3_0>`.
+     */
+    template <version_gated T>
+    inline T decode(const structure& structure, const version_id& version,
+        typename T::field_type fields = T::field_type::all)
+    {
+        return detail::decode_at<T, std::size(T::versions) - 1>(structure, version, fields);
+    }
+
+    /**
+     * @brief Decodes the @p Fields of @p view, selected at compile time.
+     */
+    template <decodable T, auto Fields, view_of<T> V>
+        requires std::same_as<decltype(Fields), typename T::field_type>
+    inline T decode(const V& view)
+    {
+        return T(view, Fields);
+    }
+
+    template <decodable T, auto Fields>
+        requires std::same_as<decltype(Fields), typename T::field_type>
+    inline T decode(const structure& structure)
+    {
+        return T(typename T::view_type(structure), Fields);
+    }
+
+    template <version_gated T, auto Fields>
+        requires std::same_as<decltype(Fields), typename T::field_type>
+    inline T decode(const structure& structure, const version_id& version)
+    {
+        return detail::decode_at<T, std::size(T::versions) - 1>(structure, version, Fields);
+    }
+}
+
+#endif // !DMI_DECODE_H
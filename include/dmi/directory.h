@@ -0,0 +1,237 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_DIRECTORY_H
+#define DMI_DIRECTORY_H
+
+#pragma once
+
+#include <array>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <dmi/types.h>
+#include <dmi/table.h>
+#include <dmi/structure.h>
+
+namespace dmi
+{
+    /**
+     * @brief Directory record.
+     *
+     * @details
+     * Describes where a structure is in the table. Records are kept in table
+     * order, the size of a structure is the distance to the next record.
+     */
+    struct directory_record
+    {
+        /**
+         * @brief Offset of the structure from the start of the table.
+         */
+        uint32_t offset;
+
+        /**
+         * @brief Type of structure.
+         */
+        uint8_t type;
+
+        /**
+         * @brief Length of the formatted area.
+         */
+        uint8_t length;
+
+        /**
+         * @brief Structure handle.
+         */
+        handle_t handle;
+    };
+
+    static_assert(sizeof(directory_record) == 8);
+
+    class snapshot;
+
+    namespace detail
+    {
+        /**
+         * @brief Smallest number of slots of the handle hash.
+         */
+        constexpr size_t handle_slots_min = 16;
+
+        /**
+         * @brief Fibonacci hash of a handle, @p shift keeps the top bits.
+         */
+        constexpr uint32_t handle_hash(handle_t handle, unsigned shift) noexcept
+        {
+            return uint32_t(handle * 2654435769u) >> shift;
+        }
+
+        /**
+         * @brief Looks @p handle up in an open-addressing table of record
+         * indices plus one, as built by dmi::directory.
+         */
+        inline std::optional<size_t> find_handle(std::span<const uint32_t> slots,
+            unsigned shift, std::span<const directory_record> records, handle_t handle)
+        {
+            if (slots.empty())
+                return std::nullopt;
+
+            size_t mask = slots.size() - 1;
+
+            for (size_t slot = handle_hash(handle, shift) & mask;; slot = (slot + 1) & mask) {
+                uint32_t entry = slots[slot];
+                if (entry == 0)
+                    return std::nullopt;
+                if (records[entry - 1].handle == handle)
+                    return entry - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Structure directory.
+     *
+     * @details
+     * Index of a table built in a single pass, answering lookups by handle
+     * and by type in constant time without walking the table again:
+     *
+     * - records of all structures (including inactive ones), in table order;
+     * - offsets of the strings of each structure;
+     * - record indices grouped by type, with a bucket per type;
+     * - an open-addressing hash of the handles;
+     * - a 256-bit type presence bitmap.
+     *
+     * The directory points into the table it was built from, which must
+     * outlive it. Its arrays are allocated from a memory resource, e.g. the
+     * arena of a dmi::context.
+     */
+    class directory
+    {
+    private:
+        std::span<const std::byte> m_table;
+        std::pmr::vector<directory_record> m_records;
+        std::pmr::vector<uint16_t> m_strings;
+        std::pmr::vector<uint32_t> m_string_index;
+        std::pmr::vector<uint32_t> m_by_type;
+        std::array<uint32_t, 257> m_buckets;
+        std::pmr::vector<uint32_t> m_handles;
+        unsigned m_handle_shift;
+        std::array<uint64_t, 4> m_types;
+
+        friend class snapshot;
+
+    public:
+        explicit directory(std::pmr::memory_resource *resource
+            = std::pmr::get_default_resource()) noexcept;
+
+        /**
+         * @brief Indexes @p table.
+         *
+         * @details
+         * Indexing stops at the end-of-table structure, at the end of the
+         * buffer or at the first malformed structure. @p count is an
+         * optional hint of the number of structures (e.g. from the entry
+         * point) used to size the directory up front.
+         */
+        explicit directory(std::span<const std::byte> table, size_t count = 0,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+        /**
+         * @brief Table the directory was built from.
+         */
+        inline auto table() const -> std::span<const std::byte> { return m_table; }
+
+        /**
+         * @brief Number of indexed structures.
+         */
+        inline size_t size() const
+        {
+            return m_records.empty() ? 0 : m_records.size() - 1;
+        }
+
+        /**
+         * @brief Records of indexed structures, in table order.
+         */
+        inline auto records() const -> std::span<const directory_record>
+        {
+            return std::span(m_records).first(size());
+        }
+
+        /**
+         * @brief Returns the structure described by the record at @p index.
+         */
+        inline structure at(size_t index) const
+        {
+            uint32_t offset = m_records[index].offset;
+            uint32_t first = m_string_index[index];
+
+            return {
+                m_table.data() + offset, m_records[index + 1].offset - offset,
+                m_strings.data() + first, m_string_index[index + 1] - first
+            };
+        }
+
+        /**
+         * @brief Checks whether the table has structures of @p type.
+         */
+        inline bool contains(uint8_t type) const
+        {
+            return (m_types[type >> 6] >> (type & 63)) & 1;
+        }
+
+        inline bool contains(table_type type) const
+        {
+            return contains(uint8_t(type));
+        }
+
+        /**
+         * @brief Record indices of structures of @p type, in table order.
+         */
+        inline auto indices(uint8_t type) const -> std::span<const uint32_t>
+        {
+            return std::span(m_by_type).subspan(m_buckets[type],
+                m_buckets[type + 1] - m_buckets[type]);
+        }
+
+        /**
+         * @brief Range of structures of @p type, in table order.
+         */
+        inline auto find(table_type type) const
+        {
+            return indices(uint8_t(type)) | std::views::transform(
+                [this](uint32_t index) { return at(index); });
+        }
+
+        /**
+         * @brief Finds the record index of the structure with @p handle.
+         *
+         * @details
+         * If several structures share a handle, the first one wins.
+         */
+        inline std::optional<size_t> index_of(handle_t handle) const
+        {
+            return detail::find_handle(m_handles, m_handle_shift, m_records, handle);
+        }
+
+        /**
+         * @brief Finds the structure with @p handle.
+         */
+        inline std::optional<structure> find(handle_t handle) const
+        {
+            auto index = index_of(handle);
+            if (!index)
+                return std::nullopt;
+
+            return at(*index);
+        }
+
+    private:
+        void index_types();
+        void index_handles();
+    };
+}
+
+#endif // !DMI_DIRECTORY_H
@@ -7,12 +7,12 @@
 
 #pragma once
 
-#include <string>
-#include <memory>
-#include <map>
-#include <filesystem>
+#include <cstddef>
+#include <optional>
+#include <span>
 
 #include <dmi/types.h>
+#include <dmi/error.h>
 #include <dmi/version.h>
 
 /**
@@ -30,6 +30,20 @@
  */
 #define DMI_ANCHOR_V30 "_SM3_"
 
+/**
+ * @brief Entry Point Structure (EPS) types.
+ *
+ * @details
+ * Values are ordered by preference: when a system exposes several entry
+ * points, the one with the highest value should be used.
+ */
+typedef enum dmi_entry_type : uint8_t
+{
+    DMI_ENTRY_LEGACY = 0, //< SMBIOS 2.0 or earlier (32-bit)
+    DMI_ENTRY_V21    = 1, //< SMBIOS 2.1 or later (32-bit)
+    DMI_ENTRY_V30    = 2  //< SMBIOS 3.0 or later (64-bit)
+} dmi_entry_type_t;
+
 /**
  * @brief The 32-bit SMBIOS legacy Entry Point Structure (EPS).
  */
@@ -114,6 +128,12 @@ struct dmi_entry_legacy
     const uint8_t version;
 }  __attribute((packed));
 
+static_assert(sizeof(dmi_entry_legacy_t) == 0x0F);
+static_assert(offsetof(dmi_entry_legacy_t, table_area_size) == 0x06);
+static_assert(offsetof(dmi_entry_legacy_t, table_area_addr) == 0x08);
+static_assert(offsetof(dmi_entry_legacy_t, table_count) == 0x0C);
+static_assert(offsetof(dmi_entry_legacy_t, version) == 0x0E);
+
 /**
  * @brief The 32-bit SMBIOS 2.1+ Entry Point Structure (EPS).
  */
@@ -208,6 +228,12 @@ struct dmi_entry_v21
     dmi_entry_legacy_t ieps;
 }  __attribute((packed));
 
+static_assert(sizeof(dmi_entry_v21_t) == 0x1F);
+static_assert(offsetof(dmi_entry_v21_t, length) == 0x05);
+static_assert(offsetof(dmi_entry_v21_t, version_major) == 0x06);
+static_assert(offsetof(dmi_entry_v21_t, table_size_max) == 0x08);
+static_assert(offsetof(dmi_entry_v21_t, ieps) == 0x10);
+
 /**
  * @brief The 64-bit SMBIOS 3.0+ Entry Point Structure (EPS).
  */
@@ -311,40 +337,152 @@ struct dmi_entry_v30
     const uint64_t table_area_addr;
 } __attribute((packed));
 
+static_assert(sizeof(dmi_entry_v30_t) == 0x18);
+static_assert(offsetof(dmi_entry_v30_t, length) == 0x06);
+static_assert(offsetof(dmi_entry_v30_t, version_major) == 0x07);
+static_assert(offsetof(dmi_entry_v30_t, table_area_size_max) == 0x0C);
+static_assert(offsetof(dmi_entry_v30_t, table_area_addr) == 0x10);
+
 namespace dmi
 {
-    class entry
-    {
-    public:
-        entry(const std::string& anchor, const std::byte *data, size_t length);
-        virtual ~entry();
-
-    public:
-        using factory =
-            std::unique_ptr<entry>(*)(const std::byte *ptr, size_t length);
-        static auto create(const std::byte *ptr, size_t length)
-            -> std::unique_ptr<entry>;
-    };
-
-    class entry_legacy : public entry
+    /**
+     * @brief Entry Point Structure (EPS) types.
+     *
+     * @see #dmi_entry_type
+     */
+    enum class entry_type : uint8_t
     {
-    public:
-        entry_legacy(const std::byte *data, size_t length);
-        virtual ~entry_legacy();
+        legacy = DMI_ENTRY_LEGACY, //< SMBIOS 2.0 or earlier (32-bit)
+        v21    = DMI_ENTRY_V21,    //< SMBIOS 2.1 or later (32-bit)
+        v30    = DMI_ENTRY_V30     //< SMBIOS 3.0 or later (64-bit)
     };
 
-    class entry_v21 : public entry
+    /**
+     * @brief Decoded SMBIOS Entry Point Structure (EPS).
+     *
+     * @details
+     * Trivially copyable value describing where the structure table is and
+     * which version of SMBIOS specification it implements. Decoding an entry
+     * point never allocates memory.
+     */
+    class entry
     {
-    public:
-        entry_v21(const std::byte *data, size_t length);
-        virtual ~entry_v21();
-    };
+    private:
+        entry_type m_type;
+        uint8_t m_length;
+        uint16_t m_table_count;
+        uint16_t m_table_size_max;
+        uint32_t m_table_size;
+        uint64_t m_table_addr;
+        version_id m_version;
 
-    class entry_v30 : public entry
-    {
     public:
-        entry_v30(const std::byte *data, size_t length);
-        virtual ~entry_v30();
+        /**
+         * @brief Decodes the entry point at the start of a buffer.
+         *
+         * @details
+         * Identifies the entry point by its anchor string, checks that the
+         * buffer holds all of it, that its length field is sane and that its
+         * checksum (as well as the IEPS one for SMBIOS 2.1+) is valid.
+         *
+         * @return Decoded entry point, or nothing if the buffer does not
+         * start with a valid entry point.
+         */
+        static auto parse(const std::byte *ptr, size_t length) noexcept
+            -> std::optional<entry>;
+
+        /**
+         * @copydoc parse(const std::byte *, size_t)
+         */
+        static inline auto parse(std::span<const std::byte> data) noexcept
+            -> std::optional<entry>
+        {
+            return parse(data.data(), data.size());
+        }
+
+        /**
+         * @brief Decodes the entry point at the start of a buffer.
+         *
+         * @details
+         * Same checks as parse(), reporting which one failed and the offset
+         * of the offending field.
+         */
+        static auto try_create(const std::byte *ptr, size_t length) noexcept
+            -> result<entry>;
+
+        /**
+         * @copydoc try_create(const std::byte *, size_t)
+         */
+        static inline auto try_create(std::span<const std::byte> data) noexcept
+            -> result<entry>
+        {
+            return try_create(data.data(), data.size());
+        }
+
+        /**
+         * @brief Decodes the entry point at the start of a buffer.
+         *
+         * @throws std::invalid_argument
+         * @throws std::runtime_error
+         */
+        static auto create(const std::byte *ptr, size_t length) -> entry;
+
+        /**
+         * @brief Entry point type.
+         */
+        inline entry_type type() const { return m_type; }
+
+        /**
+         * @brief Entry point length, in bytes.
+         */
+        inline size_t length() const { return m_length; }
+
+        /**
+         * @brief SMBIOS version implemented by the structure table.
+         */
+        inline const version_id& version() const { return m_version; }
+
+        /**
+         * @brief Physical address of the structure table.
+         */
+        inline uint64_t table_address() const { return m_table_addr; }
+
+        /**
+         * @brief Size of the structure table, in bytes.
+         *
+         * @details
+         * For SMBIOS 3.0+ entry points this is the maximum size, the actual
+         * table may be shorter and is terminated by an end-of-table structure.
+         */
+        inline uint32_t table_size() const { return m_table_size; }
+
+        /**
+         * @brief Number of structures in the table.
+         *
+         * @details
+         * Not provided by SMBIOS 3.0+ entry points.
+         */
+        inline std::optional<uint16_t> table_count() const
+        {
+            if (m_type == entry_type::v30)
+                return std::nullopt;
+
+            return m_table_count;
+        }
+
+        /**
+         * @brief Size of the largest structure, in bytes.
+         *
+         * @details
+         * Only provided by SMBIOS 2.1+ (32-bit) entry points.
+         */
+        inline std::optional<uint16_t> table_size_max() const
+        {
+            if (m_type != entry_type::v21)
+                return std::nullopt;
+
+            return m_table_size_max;
+        }
     };
 }
 
@@ -0,0 +1,79 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_ENUM_H
+#define DMI_ENUM_H
+
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+#if defined(__cpp_exceptions)
+#include <stdexcept>
+#endif
+
+#include <dmi/error.h>
+#include <dmi/names.h>
+
+namespace dmi
+{
+    /**
+     * @brief Enumeration with a name table.
+     *
+     * @details
+     * The header of the enumeration declares, next to its to_string(), a
+     * `names_of()` overload returning its name table, found by
+     * argument-dependent lookup.
+     */
+    template <typename E>
+    concept named_enum = std::is_enum_v<E> && requires(E value) {
+        { names_of(value).size() } -> std::convertible_to<size_t>;
+    };
+
+    namespace detail
+    {
+        template <named_enum E>
+        inline constexpr auto name_index_of =
+            make_name_index<name_slots(names_of(E{}))>(names_of(E{}));
+    }
+
+    /**
+     * @brief Looks an enumeration value up by its name, as returned by
+     * to_string().
+     *
+     * @details
+     * Goes through a perfect hash built at compile time: one hash, one
+     * table load and one string comparison, whatever the number of names.
+     *
+     * @code
+     * auto type = dmi::try_from_string<dmi::table::chassis_type>("Desktop");
+     * @endcode
+     */
+    template <named_enum E>
+    constexpr auto try_from_string(std::string_view name) noexcept -> result<E>
+    {
+        auto value = detail::name_index_of<E>.find(names_of(E{}), name);
+        if (!value)
+            return std::unexpected(error{ errc::unknown_value });
+
+        return E(*value);
+    }
+
+    /**
+     * @copydoc try_from_string()
+     *
+     * @throws std::invalid_argument
+     */
+    template <named_enum E>
+    constexpr E from_string(std::string_view name)
+    {
+        auto value = try_from_string<E>(name);
+        if (!value)
+            DMI_THROW(std::invalid_argument("name"));
+
+        return *value;
+    }
+}
+
+#endif // !DMI_ENUM_H
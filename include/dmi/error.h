@@ -0,0 +1,114 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_ERROR_H
+#define DMI_ERROR_H
+
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <string_view>
+
+#include <dmi/types.h>
+#include <dmi/names.h>
+
+namespace dmi
+{
+    /**
+     * @brief Error codes of the non-throwing API.
+     */
+    enum class errc : uint8_t
+    {
+        invalid_argument = 1, //< Null pointer, empty or oversized buffer
+        no_anchor,            //< No entry point anchor string
+        truncated,            //< Data ends before the structure it holds
+        bad_length,           //< Length field out of range
+        bad_checksum,         //< Checksum mismatch
+        unknown_value,        //< Enumeration value without a name
+        malformed,            //< Inconsistent or unparsable input (snapshot, sysfs entries, tar, text)
+        io,                   //< System call failure, errno in error::offset
+        unknown_format        //< Data in none of the supported dump formats
+    };
+
+    namespace detail
+    {
+        inline constexpr name_entry errc_entries[] = {
+            { unsigned(errc::invalid_argument), "Invalid argument" },
+            { unsigned(errc::no_anchor),        "No entry point anchor" },
+            { unsigned(errc::truncated),        "Truncated data" },
+            { unsigned(errc::bad_length),       "Length out of range" },
+            { unsigned(errc::bad_checksum),     "Checksum mismatch" },
+            { unsigned(errc::unknown_value),    "Unknown value" },
+            { unsigned(errc::malformed),        "Malformed data" },
+            { unsigned(errc::io),               "I/O error" },
+            { unsigned(errc::unknown_format),   "Unknown format" }
+        };
+
+        inline constexpr auto& errc_names = names<10, errc_entries>;
+    }
+
+    /**
+     * @brief Error reported by the non-throwing API.
+     *
+     * @details
+     * Small enough to be returned in registers: where the error was found,
+     * as an offset in the input, and the handle of the structure involved,
+     * if any. For @ref errc::io, the offset holds `errno` instead.
+     */
+    struct error
+    {
+        errc code;
+        handle_t handle = 0xFFFF;
+        uint32_t offset = 0;
+    };
+
+    static_assert(sizeof(error) == 8);
+
+    /**
+     * @brief Result of a fallible operation of the non-throwing API.
+     *
+     * @details
+     * Operations that throw have a `try_` counterpart returning one of
+     * these, the throwing one being a thin wrapper around it.
+     */
+    template <typename T>
+    using result = std::expected<T, error>;
+
+    /**
+     * @brief Error description, or an empty view for an unknown code.
+     */
+    constexpr std::string_view to_string(errc value) noexcept
+    {
+        return detail::name_of(detail::errc_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(errc) noexcept
+    {
+        return detail::errc_names;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Looks @p value up in @p names.
+         */
+        template <typename E, size_t N, size_t Size>
+            requires std::is_enum_v<E>
+        constexpr auto try_name(const name_table<N, Size>& names,
+            E value) noexcept -> result<std::string_view>
+        {
+            auto name = name_of(names, value);
+            if (name.empty())
+                return std::unexpected(error{ errc::unknown_value });
+
+            return name;
+        }
+    }
+}
+
+#endif // !DMI_ERROR_H
@@ -0,0 +1,93 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_FIELD_H
+#define DMI_FIELD_H
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Loads @p member of the packed structure @p type laid out at @p ptr.
+ *
+ * @details
+ * The C structures only document the layout: fields are read at their
+ * offset with dmi::load() instead of through a (packed, possibly
+ * misaligned) pointer.
+ */
+#define DMI_FIELD(ptr, type, member) \
+    ::dmi::load<std::remove_cv_t<decltype(type::member)>>((ptr) + offsetof(type, member))
+
+namespace dmi
+{
+    /**
+     * @brief Field type that can be loaded from a table: an integer or an
+     * enumeration.
+     */
+    template <typename T>
+    concept loadable = std::integral<T> || std::is_enum_v<T>;
+
+    /**
+     * @brief Loads a little-endian @p T from the unaligned address @p ptr.
+     *
+     * @details
+     * Compiles to a single load on little-endian targets (plus a byte swap
+     * on big-endian ones), and to plain shifts in constant evaluation.
+     */
+    template <loadable T>
+    constexpr T load(const std::byte *ptr) noexcept
+    {
+        if constexpr (std::is_enum_v<T>) {
+            return T(load<std::underlying_type_t<T>>(ptr));
+        } else if constexpr (sizeof(T) == 1) {
+            return T(ptr[0]);
+        } else {
+            using U = std::make_unsigned_t<T>;
+
+            if consteval {
+                U value = 0;
+                for (size_t i = 0; i < sizeof(T); i++)
+                    value |= U(U(uint8_t(ptr[i])) << (i * 8));
+                return T(value);
+            } else {
+                U value;
+                std::memcpy(&value, ptr, sizeof(value));
+                if constexpr (std::endian::native == std::endian::big)
+                    value = std::byteswap(value);
+                return T(value);
+            }
+        }
+    }
+
+    /**
+     * @brief Extracts @p Width bits of @p value starting at bit @p Shift.
+     */
+    template <unsigned Shift, unsigned Width, std::unsigned_integral T>
+    constexpr T bits(T value) noexcept
+    {
+        static_assert(Shift + Width <= sizeof(T) * 8);
+
+        if constexpr (Width == sizeof(T) * 8)
+            return value;
+        else
+            return T(value >> Shift) & T((T(1) << Width) - 1);
+    }
+
+    /**
+     * @brief Tests bit @p Bit of @p value.
+     */
+    template <unsigned Bit, std::unsigned_integral T>
+    constexpr bool flag(T value) noexcept
+    {
+        return bits<Bit, 1>(value) != 0;
+    }
+}
+
+#endif // !DMI_FIELD_H
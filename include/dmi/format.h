@@ -0,0 +1,73 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_FORMAT_H
+#define DMI_FORMAT_H
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Offset of the structure table in `dmidecode --dump-bin` files.
+ */
+#define DMI_DUMP_BIN_TABLE_OFFSET 0x20
+
+/**
+ * @brief Size of the header of Windows `RawSMBIOSData` blobs.
+ */
+#define DMI_DUMP_WINDOWS_HEADER_SIZE 8
+
+/**
+ * @brief Raw SMBIOS dump formats.
+ */
+typedef enum dmi_dump_format : uint8_t
+{
+    DMI_DUMP_UNKNOWN = 0, //< None of the below
+    DMI_DUMP_TABLE   = 1, //< Bare structure table (sysfs `DMI`, QEMU `smbios-tables`)
+    DMI_DUMP_BIN     = 2, //< `dmidecode --dump-bin`: entry point, table at 0x20
+    DMI_DUMP_WINDOWS = 3, //< Windows `RawSMBIOSData`: 8-byte header, table
+    DMI_DUMP_TAR     = 4  //< tar archive of an entry point and table pair
+} dmi_dump_format_t;
+
+#ifdef __cplusplus
+
+#include <span>
+
+namespace dmi
+{
+    /**
+     * @brief Raw SMBIOS dump formats.
+     *
+     * @see #dmi_dump_format
+     */
+    enum class dump_format : uint8_t
+    {
+        unknown  = DMI_DUMP_UNKNOWN, //< None of the below
+        table    = DMI_DUMP_TABLE,   //< Bare structure table
+        dump_bin = DMI_DUMP_BIN,     //< `dmidecode --dump-bin`
+        windows  = DMI_DUMP_WINDOWS, //< Windows `RawSMBIOSData`
+        tar      = DMI_DUMP_TAR      //< tar archive of an entry point and table pair
+    };
+
+    /**
+     * @brief Identifies the format of a raw SMBIOS dump.
+     *
+     * @details
+     * Looks at a fixed number of bytes, whatever the size of the dump:
+     *
+     * - an entry point anchor at offset 0 makes a `--dump-bin` file;
+     * - the `ustar` magic at offset 257 makes a tar archive, expected to
+     *   hold the sysfs `smbios_entry_point` and `DMI` pair or the QEMU
+     *   `fw_cfg` `smbios-anchor` and `smbios-tables` pair;
+     * - a calling method of 0 or 1, an SMBIOS 2+ major version and a length
+     *   that fits the dump make a Windows `RawSMBIOSData` blob;
+     * - a sane structure header makes a bare structure table.
+     */
+    dump_format detect_format(std::span<const std::byte> data) noexcept;
+}
+
+#endif // __cplusplus
+
+#endif // !DMI_FORMAT_H
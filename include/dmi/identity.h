@@ -0,0 +1,130 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_IDENTITY_H
+#define DMI_IDENTITY_H
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/cdefs.h>
+
+/**
+ * @brief Size of the identity string buffers, including the terminating NUL.
+ *
+ * @details
+ * Longer strings are truncated.
+ */
+#define DMI_IDENTITY_STRING_SIZE 65
+
+/**
+ * @brief Size of a UUID in its textual form, including the terminating NUL.
+ */
+#define DMI_IDENTITY_UUID_SIZE 37
+
+/**
+ * @brief System identity.
+ */
+typedef struct dmi_identity dmi_identity_t;
+
+/**
+ * @brief Fields identifying a system, in fixed-size buffers.
+ *
+ * @details
+ * Strings are NUL-terminated and empty when the firmware does not provide
+ * them.
+ */
+struct dmi_identity
+{
+    /**
+     * @brief System UUID, as stored in the System Information structure.
+     */
+    uint8_t uuid[16];
+
+    /**
+     * @brief System UUID as text (e.g. `4c4c4544-0042-3510-8052-b4c04f333232`).
+     *
+     * @details
+     * Formatted with the SMBIOS 2.6+ byte order, the first three fields
+     * being little-endian. Empty if the UUID is not present (all `FFh`) or
+     * not set (all `00h`).
+     */
+    char uuid_str[DMI_IDENTITY_UUID_SIZE];
+
+    /**
+     * @brief Product name, from the System Information structure.
+     */
+    char product_name[DMI_IDENTITY_STRING_SIZE];
+
+    /**
+     * @brief Serial number, from the System Information structure.
+     */
+    char serial_number[DMI_IDENTITY_STRING_SIZE];
+
+    /**
+     * @brief BIOS version, from the BIOS Information structure.
+     */
+    char bios_version[DMI_IDENTITY_STRING_SIZE];
+};
+
+__BEGIN_DECLS
+
+/**
+ * @brief Reads the system identity from the sysfs tree under @p root.
+ *
+ * @details
+ * Async-signal-safe: reads the System Information and BIOS Information
+ * structures from their sysfs entries (`sys/firmware/dmi/entries`) with
+ * `open(2)`, `read(2)` and `close(2)` only, into a buffer on the stack,
+ * without allocating. `errno` is left as it was on entry.
+ *
+ * @param root Root of the file system holding sysfs, `NULL` for `/`.
+ *
+ * @return `0`, or a negated `errno` value: `-ENOENT` without a System
+ * Information structure, `-EINVAL` if it is malformed, `-ENAMETOOLONG` if
+ * @p root is too long. A missing BIOS Information structure only leaves
+ * bios_version empty.
+ */
+int dmi_identity_read(const char *root, dmi_identity_t *identity);
+
+/**
+ * @brief Reads the system identity into a static cache for
+ * dmi_identity_get().
+ *
+ * @details
+ * Meant to be called once at startup, e.g. when installing a crash handler.
+ * Not async-signal-safe with respect to itself: concurrent calls are
+ * harmless, but only the first one fills the cache.
+ *
+ * @return As dmi_identity_read().
+ */
+int dmi_identity_warm(const char *root);
+
+/**
+ * @brief Copies the system identity into @p identity.
+ *
+ * @details
+ * Async-signal-safe. Copies the cache filled by dmi_identity_warm(), a
+ * fixed-size copy that never allocates nor enters the kernel, and falls
+ * back to dmi_identity_read() from `/` while the cache is cold.
+ *
+ * @return As dmi_identity_read().
+ */
+int dmi_identity_get(dmi_identity_t *identity);
+
+__END_DECLS
+
+#ifdef __cplusplus
+
+namespace dmi
+{
+    /**
+     * @brief System identity.
+     */
+    using identity = ::dmi_identity;
+}
+
+#endif // __cplusplus
+
+#endif // !DMI_IDENTITY_H
@@ -0,0 +1,199 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_IMPORT_H
+#define DMI_IMPORT_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <dmi/enum.h>
+#include <dmi/error.h>
+#include <dmi/source.h>
+#include <dmi/table.h>
+
+namespace dmi::detail
+{
+    /**
+     * @brief How a field is printed by dmidecode.
+     */
+    enum class text_kind : uint8_t
+    {
+        integer,     //< Decimal or `0x` hexadecimal number, with its unit if any
+        handle,      //< `0x` hexadecimal handle
+        string,      //< String text, `Not Specified` for no string
+        enumeration, //< Name of an enumeration value
+        uuid         //< UUID, SMBIOS 2.6+ byte order
+    };
+
+    /**
+     * @brief Formatted area field printed by dmidecode as a `Label: value`
+     * line.
+     *
+     * @details
+     * Holds no pointers, so that the field tables need no relocation: the
+     * label and the unit are found in the label blob of the table, the
+     * enumeration by its number in the lookup function of the table.
+     */
+    struct text_field
+    {
+        uint16_t label;      //< Offset of the label, followed by the unit, in the blob
+        uint8_t label_size;  //< Size of the label
+        uint8_t offset;      //< Offset of the field in the formatted area
+        uint8_t size;        //< Size of the field
+        text_kind kind;      //< How the value is printed
+        uint8_t enumeration; //< Enumeration number, for text_kind::enumeration
+    };
+
+    /**
+     * @brief Fields of a structure type printed by dmidecode.
+     */
+    struct text_table
+    {
+        std::span<const text_field> fields;
+
+        /**
+         * @brief Labels, each followed by the unit of its field, all
+         * NUL-terminated.
+         */
+        const char *labels = nullptr;
+
+        /**
+         * @brief Looks up the value named @p name of enumeration number
+         * @p enumeration.
+         */
+        std::optional<unsigned> (*lookup)(unsigned enumeration, std::string_view name) noexcept = nullptr;
+
+        inline std::string_view label(const text_field& field) const noexcept
+        {
+            return { labels + field.label, field.label_size };
+        }
+
+        inline std::string_view unit(const text_field& field) const noexcept
+        {
+            return labels + field.label + field.label_size + 1;
+        }
+    };
+
+    /**
+     * @brief Compares dmidecode labels and names, ignoring the case and
+     * telling no space, dash and underscore apart.
+     *
+     * @details
+     * So that `Boot-up State` matches the `boot_up_state` field and `Power
+     * Switch` the `Power switch` name.
+     */
+    constexpr bool same_label(std::string_view a, std::string_view b) noexcept
+    {
+        if (a.size() != b.size())
+            return false;
+
+        auto separator = [](char c) { return c == ' ' || c == '-' || c == '_'; };
+
+        for (size_t i = 0; i < a.size(); i++) {
+            char x = a[i];
+            char y = b[i];
+
+            if (x == y)
+                continue;
+            if ((x | 0x20) == (y | 0x20) && (x | 0x20) >= 'a' && (x | 0x20) <= 'z')
+                continue;
+            if (!separator(x) || !separator(y))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Looks up the value of @p E named @p name, as printed by
+     * dmidecode.
+     *
+     * @details
+     * Goes through the perfect hash of try_from_string() first, and falls
+     * back to comparing the names with same_label() for the ones dmidecode
+     * capitalizes differently.
+     */
+    template <named_enum E>
+    std::optional<unsigned> find_name(std::string_view name) noexcept
+    {
+        if (auto value = try_from_string<E>(name))
+            return unsigned(*value);
+
+        const auto& names = names_of(E{});
+        for (size_t value = 0; value < names.size(); value++)
+            if (!names[value].empty() && same_label(names[value], name))
+                return unsigned(value);
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Fields printed by dmidecode of the generated structure type
+     * @p type, empty if it is not compiled in.
+     */
+    auto generated_text_table(table_type type) noexcept -> text_table;
+
+    /**
+     * @brief Fields printed by dmidecode of the structure type @p type.
+     */
+    auto text_table_of(table_type type) noexcept -> text_table;
+
+    /**
+     * @brief Called with the import result of every file.
+     */
+    using import_callback = void (*)(void *context, size_t index, result<source>&& source);
+
+    void import_text_files(std::span<const char *const> paths, unsigned threads,
+        import_callback callback, void *context);
+}
+
+namespace dmi
+{
+    /**
+     * @brief Imports the dmidecode text outputs in the files @p paths on
+     * @p threads threads, all the hardware threads if `0`.
+     *
+     * @details
+     * Calls @p callback with the index of each file in @p paths and its
+     * result, as source::try_import_text() reports it, from the worker
+     * threads, concurrently and in no particular order. The files are
+     * mapped and parsed in place, each worker taking the next file as soon
+     * as it is done with one. System call failures are reported as
+     * @ref errc::io, with `errno` in error::offset.
+     *
+     * @p callback must not throw. Fewer threads are used if some cannot be
+     * started.
+     *
+     * @code
+     * dmi::import_text_files(paths, [&](size_t index, dmi::result<dmi::source>&& source) {
+     *     if (source)
+     *         snapshots[index] = dmi::context(std::move(*source)).detach();
+     * });
+     * @endcode
+     *
+     * @throws std::bad_alloc
+     */
+    template <typename Callback>
+        requires std::is_invocable_v<Callback&, size_t, result<source>&&>
+    void import_text_files(std::span<const char *const> paths, Callback&& callback,
+        unsigned threads = 0)
+    {
+        detail::import_text_files(paths, threads,
+            [](void *context, size_t index, result<source>&& source) {
+                (*static_cast<std::remove_reference_t<Callback> *>(context))(index, std::move(source));
+            },
+            const_cast<void *>(static_cast<const void *>(std::addressof(callback))));
+    }
+}
+
+#endif // !DMI_IMPORT_H
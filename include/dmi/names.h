@@ -0,0 +1,259 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_NAMES_H
+#define DMI_NAMES_H
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#if defined(__cpp_exceptions)
+#include <stdexcept>
+#endif
+
+#include <dmi/types.h>
+
+namespace dmi::detail
+{
+    /**
+     * @brief Name of an enumeration value.
+     *
+     * @details
+     * Only used in constant expressions, to build a name_table.
+     */
+    struct name_entry
+    {
+        unsigned value;
+        std::string_view name;
+    };
+
+    /**
+     * @brief Names of the @p N values of an enumeration.
+     *
+     * @details
+     * The names are stored in value order in a single blob of @p Size
+     * characters, each one followed by a NUL so that it can be handed out to
+     * C callers, and found through @p N + 1 16-bit offsets. Unused values
+     * have an empty name.
+     *
+     * The table holds no pointers, so it needs no relocation when the
+     * library is loaded.
+     */
+    template <size_t N, size_t Size>
+    struct name_table
+    {
+        static_assert(Size <= 0xFFFF);
+
+        std::array<char, Size> blob;
+        std::array<uint16_t, N + 1> offsets;
+
+        /**
+         * @brief Number of values.
+         */
+        static constexpr size_t size() noexcept { return N; }
+
+        /**
+         * @brief Name of @p value, which must be less than size().
+         */
+        constexpr std::string_view operator[](size_t value) const noexcept
+        {
+            return { blob.data() + offsets[value], size_t(offsets[value + 1] - offsets[value] - 1) };
+        }
+    };
+
+    /**
+     * @brief Size of the blob of a name table of @p N values holding
+     * @p entries.
+     */
+    template <size_t M>
+    consteval size_t names_size(size_t N, const name_entry (&entries)[M])
+    {
+        size_t size = N;
+        for (const auto& entry : entries)
+            size += entry.name.size();
+
+        return size;
+    }
+
+    /**
+     * @brief Builds a name table of @p N values from @p entries.
+     *
+     * @details
+     * @p Size must be names_size(N, entries).
+     */
+    template <size_t N, size_t Size, size_t M>
+    consteval auto make_names(const name_entry (&entries)[M]) -> name_table<N, Size>
+    {
+        std::array<std::string_view, N> by_value{};
+        for (const auto& entry : entries)
+            by_value[entry.value] = entry.name;
+
+        name_table<N, Size> result{};
+        size_t offset = 0;
+
+        for (size_t value = 0; value < N; value++) {
+            result.offsets[value] = uint16_t(offset);
+
+            for (char c : by_value[value])
+                result.blob[offset++] = c;
+            result.blob[offset++] = '\0';
+        }
+
+        result.offsets[N] = uint16_t(offset);
+
+        if (offset != Size)
+            DMI_THROW("name table size mismatch");
+
+        return result;
+    }
+
+    /**
+     * @brief Name table of @p N values holding the entries of the array
+     * @p Entries.
+     */
+    template <size_t N, const auto& Entries>
+    inline constexpr auto names = make_names<N, names_size(N, Entries)>(Entries);
+
+    /**
+     * @brief Looks @p value up in @p names.
+     *
+     * @return The name, or an empty view if @p value has none.
+     */
+    template <typename E, size_t N, size_t Size>
+        requires std::is_enum_v<E>
+    constexpr std::string_view name_of(const name_table<N, Size>& names, E value) noexcept
+    {
+        auto index = size_t(std::underlying_type_t<E>(value));
+        return index < N ? names[index] : std::string_view();
+    }
+
+    /**
+     * @brief Looks @p value up in @p names.
+     *
+     * @throws std::invalid_argument
+     */
+    template <typename E, size_t N, size_t Size>
+        requires std::is_enum_v<E>
+    constexpr std::string_view to_name(const name_table<N, Size>& names, E value)
+    {
+        auto name = name_of(names, value);
+        if (name.empty())
+            DMI_THROW(std::invalid_argument("value"));
+
+        return name;
+    }
+
+    /**
+     * @brief Seeded FNV-1a hash of a name.
+     */
+    constexpr uint32_t name_hash(std::string_view name, uint32_t seed) noexcept
+    {
+        uint32_t hash = 2166136261u ^ seed;
+
+        for (char c : name) {
+            hash ^= uint8_t(c);
+            hash *= 16777619u;
+        }
+
+        return hash ^ (hash >> 15);
+    }
+
+    /**
+     * @brief Number of slots of the name index of @p names.
+     *
+     * @details
+     * Four slots per name keep the seed search short at compile time.
+     */
+    template <size_t N, size_t Size>
+    consteval size_t name_slots(const name_table<N, Size>& names)
+    {
+        size_t count = 0;
+        for (size_t value = 0; value < N; value++)
+            count += !names[value].empty();
+
+        return std::bit_ceil(std::max<size_t>(count * 4, 4));
+    }
+
+    /**
+     * @brief Perfect hash of the names of an enumeration, for reverse
+     * lookups.
+     *
+     * @details
+     * Each name hashes to its own slot, which holds its value plus one
+     * (`0` for an empty slot), so a lookup is one hash, one load and one
+     * comparison. Values without a name (unused slots of the name table)
+     * are not indexed and never found.
+     */
+    template <size_t Slots>
+    struct name_index
+    {
+        uint32_t seed;
+        std::array<uint16_t, Slots> slots;
+
+        template <size_t N, size_t Size>
+        constexpr std::optional<unsigned> find(const name_table<N, Size>& names,
+            std::string_view name) const noexcept
+        {
+            unsigned slot = slots[name_hash(name, seed) & (Slots - 1)];
+            if (slot == 0 || names[slot - 1] != name)
+                return std::nullopt;
+
+            return slot - 1;
+        }
+    };
+
+    /**
+     * @brief Builds the name index of @p names, searching for a seed
+     * without collisions.
+     */
+    template <size_t Slots, size_t N, size_t Size>
+    consteval auto make_name_index(const name_table<N, Size>& names)
+        -> name_index<Slots>
+    {
+        static_assert(N < 0xFFFF);
+
+        for (uint32_t seed = 0; seed < 0x10000; seed++) {
+            name_index<Slots> result{ seed, {} };
+            bool collision = false;
+
+            for (size_t value = 0; value < N && !collision; value++) {
+                if (names[value].empty())
+                    continue;
+
+                auto& slot = result.slots[name_hash(names[value], seed) & (Slots - 1)];
+                if (slot != 0)
+                    collision = true;
+
+                slot = uint16_t(value + 1);
+            }
+
+            if (!collision)
+                return result;
+        }
+
+        DMI_THROW("no perfect hash seed (duplicate names?)");
+    }
+
+    /**
+     * @brief Looks @p value up in @p names, for the C API.
+     *
+     * @return The name, or `nullptr` if @p value has none.
+     */
+    template <typename E, size_t N, size_t Size>
+        requires std::is_enum_v<E>
+    constexpr const char *c_name(const name_table<N, Size>& names, E value) noexcept
+    {
+        auto name = name_of(names, value);
+        return name.empty() ? nullptr : name.data();
+    }
+}
+
+#endif // !DMI_NAMES_H
@@ -0,0 +1,68 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SCAN_H
+#define DMI_SCAN_H
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <dmi/entry.h>
+
+/**
+ * @brief Alignment of SMBIOS entry point anchors, in bytes.
+ *
+ * @details
+ * The SMBIOS specification requires the anchor string to start on a
+ * paragraph (16-byte) boundary.
+ */
+#define DMI_ANCHOR_ALIGNMENT 16
+
+namespace dmi
+{
+    /**
+     * @brief Entry point candidate found by scan_entries().
+     */
+    struct entry_candidate
+    {
+        /**
+         * @brief Offset of the anchor string from the start of the buffer.
+         */
+        size_t offset;
+
+        /**
+         * @brief Entry point type, as identified by the anchor string.
+         */
+        entry_type type;
+
+        /**
+         * @brief Whether the checksum (and length) of the entry point are
+         * valid.
+         */
+        bool valid;
+    };
+
+    /**
+     * @brief Finds SMBIOS entry points in an arbitrary memory buffer.
+     *
+     * @details
+     * Looks for `_SM3_`, `_SM_` and `_DMI_` anchors at every
+     * @ref DMI_ANCHOR_ALIGNMENT boundary relative to the start of @p data
+     * and verifies each candidate. Candidates are ranked by preference:
+     * valid ones first, then by entry point type (newest first), then by
+     * offset.
+     *
+     * The search runs with the widest SIMD instruction set supported by the
+     * CPU (AVX2 or SSE2 on x86, NEON on ARM) and falls back to a portable
+     * loop elsewhere, so it is bound by memory bandwidth on large images
+     * such as memory dumps and firmware ROMs.
+     */
+    auto scan_entries(std::span<const std::byte> data)
+        -> std::vector<entry_candidate>;
+}
+
+#endif // !DMI_SCAN_H
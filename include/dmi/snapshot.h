@@ -0,0 +1,216 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SNAPSHOT_H
+#define DMI_SNAPSHOT_H
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <span>
+
+#include <dmi/types.h>
+#include <dmi/error.h>
+#include <dmi/directory.h>
+#include <dmi/structure.h>
+#include <dmi/traits.h>
+#include <dmi/version.h>
+
+namespace dmi
+{
+    /**
+     * @brief Self-contained copy of SMBIOS data.
+     *
+     * @details
+     * Holds the entry point, the structure table and its directory in a
+     * single allocation that refers to itself by offsets only. It does not
+     * depend on the context or the memory it was taken from, and can be
+     * copied (a single `memcpy(3)`), released (a single `free(3)`), or
+     * written out with bytes() and loaded back with load().
+     *
+     * Strings stay in the string sets of the table and are found through
+     * the 16-bit offsets of the directory, so the snapshot holds no string
+     * objects of its own.
+     */
+    class snapshot
+    {
+    private:
+        std::byte *m_data;
+
+    public:
+        snapshot() noexcept;
+
+        /**
+         * @brief Copies @p entry_point, the table of @p directory and
+         * @p directory itself into a new snapshot.
+         *
+         * @throws std::length_error
+         * @throws std::bad_alloc
+         */
+        snapshot(std::span<const std::byte> entry_point,
+            const dmi::directory& directory, const version_id& version);
+
+        snapshot(const snapshot& other);
+        snapshot(snapshot&& other) noexcept;
+        ~snapshot();
+
+        snapshot& operator=(const snapshot& other);
+        snapshot& operator=(snapshot&& other) noexcept;
+
+        /**
+         * @brief Loads a snapshot from the output of bytes().
+         *
+         * @details
+         * The bytes are copied and checked, so that they may come from an
+         * untrusted source.
+         *
+         * @throws std::invalid_argument
+         * @throws std::bad_alloc
+         */
+        static auto load(std::span<const std::byte> bytes) -> snapshot;
+
+        /**
+         * @brief load(), reporting malformed bytes as an error instead of
+         * throwing.
+         *
+         * @throws std::bad_alloc
+         */
+        static auto try_load(std::span<const std::byte> bytes) -> result<snapshot>;
+
+        /**
+         * @brief The single allocation holding the snapshot.
+         */
+        auto bytes() const noexcept -> std::span<const std::byte>;
+
+        auto entry_point() const noexcept -> std::span<const std::byte>;
+        auto table() const noexcept -> std::span<const std::byte>;
+
+        /**
+         * @brief SMBIOS version implemented by the table.
+         */
+        version_id version() const noexcept;
+
+        /**
+         * @brief Number of indexed structures.
+         */
+        inline size_t size() const noexcept
+        {
+            auto records = all_records();
+            return records.empty() ? 0 : records.size() - 1;
+        }
+
+        /**
+         * @brief Records of indexed structures, in table order.
+         */
+        inline auto records() const noexcept -> std::span<const directory_record>
+        {
+            return all_records().first(size());
+        }
+
+        /**
+         * @brief Returns the structure described by the record at @p index.
+         */
+        inline structure at(size_t index) const noexcept
+        {
+            auto records = all_records();
+            auto string_index = this->string_index();
+
+            uint32_t offset = records[index].offset;
+            uint32_t first = string_index[index];
+
+            return {
+                table().data() + offset, records[index + 1].offset - offset,
+                strings().data() + first, string_index[index + 1] - first
+            };
+        }
+
+        /**
+         * @brief Checks whether the table has structures of @p type.
+         */
+        inline bool contains(table_type type) const noexcept
+        {
+            auto types = this->types();
+            return !types.empty() && ((types[uint8_t(type) >> 6] >> (uint8_t(type) & 63)) & 1);
+        }
+
+        /**
+         * @brief Record indices of structures of @p type, in table order.
+         */
+        inline auto indices(uint8_t type) const noexcept -> std::span<const uint32_t>
+        {
+            auto buckets = this->buckets();
+            if (buckets.empty())
+                return {};
+
+            return by_type().subspan(buckets[type], buckets[type + 1] - buckets[type]);
+        }
+
+        /**
+         * @brief Range of structures of @p type, in table order.
+         */
+        inline auto find(table_type type) const
+        {
+            return indices(uint8_t(type)) | std::views::transform(
+                [this](uint32_t index) { return at(index); });
+        }
+
+        /**
+         * @brief Finds the record index of the structure with @p handle.
+         */
+        inline std::optional<size_t> index_of(handle_t handle) const
+        {
+            return detail::find_handle(handles(), handle_shift(), all_records(), handle);
+        }
+
+        /**
+         * @brief Finds the structure with @p handle.
+         */
+        inline std::optional<structure> find(handle_t handle) const
+        {
+            auto index = index_of(handle);
+            if (!index)
+                return std::nullopt;
+
+            return at(*index);
+        }
+
+        /**
+         * @brief Range of the typed views of the structures of @p Type, in
+         * table order.
+         *
+         * @details
+         * Structures shorter than the view's minimum length are skipped.
+         */
+        template <table_type Type>
+            requires registered_table<Type>
+        inline auto get() const
+        {
+            using view = typename table_traits<Type>::view_type;
+
+            return indices(uint8_t(Type))
+                | std::views::filter([this](uint32_t index) {
+                      return all_records()[index].length >= view::min_length;
+                  })
+                | std::views::transform([this](uint32_t index) {
+                      return view(at(index));
+                  });
+        }
+
+    private:
+        explicit snapshot(std::byte *data) noexcept;
+
+        auto all_records() const noexcept -> std::span<const directory_record>;
+        auto strings() const noexcept -> std::span<const uint16_t>;
+        auto string_index() const noexcept -> std::span<const uint32_t>;
+        auto by_type() const noexcept -> std::span<const uint32_t>;
+        auto buckets() const noexcept -> std::span<const uint32_t>;
+        auto handles() const noexcept -> std::span<const uint32_t>;
+        auto types() const noexcept -> std::span<const uint64_t>;
+        unsigned handle_shift() const noexcept;
+    };
+}
+
+#endif // !DMI_SNAPSHOT_H
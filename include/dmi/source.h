@@ -0,0 +1,271 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SOURCE_H
+#define DMI_SOURCE_H
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include <dmi/types.h>
+#include <dmi/error.h>
+#include <dmi/table.h>
+#include <dmi/format.h>
+
+/**
+ * @brief Default root of the file system holding the sysfs DMI tree.
+ */
+#define DMI_SYSFS_ROOT "/"
+
+/**
+ * @brief Path of the SMBIOS Entry Point Structure relative to the root.
+ */
+#define DMI_SYSFS_ENTRY_POINT "sys/firmware/dmi/tables/smbios_entry_point"
+
+/**
+ * @brief Path of the SMBIOS structure table relative to the root.
+ */
+#define DMI_SYSFS_TABLE "sys/firmware/dmi/tables/DMI"
+
+/**
+ * @brief Path of the per-structure sysfs tree relative to the root.
+ *
+ * @details
+ * Holds a `<type>-<instance>` directory per structure, its `raw` file
+ * being the whole structure, formatted area and string set.
+ */
+#define DMI_SYSFS_ENTRIES "sys/firmware/dmi/entries"
+
+/**
+ * @brief Maximum size of the SMBIOS Entry Point Structure, in bytes.
+ *
+ * @details
+ * The largest EPS defined so far is the 2.1+ one (`0x1F` bytes).
+ */
+#define DMI_ENTRY_POINT_MAX 32
+
+#ifdef __cplusplus
+
+namespace dmi
+{
+    /**
+     * @brief Raw SMBIOS data source.
+     *
+     * @details
+     * Owns the memory holding the SMBIOS Entry Point Structure (EPS) and the
+     * structure table. The table is mapped read-only from the file it was
+     * loaded from or, when the file cannot be mapped (sysfs binary attributes
+     * do not support `mmap(2)`), read into a single heap buffer. The EPS is
+     * small enough to be kept inline. The table need not start the memory
+     * owned, e.g. when it is found in the middle of a mapped dump file.
+     *
+     * Everything built on top of a source points into its buffer, so the
+     * source must outlive it. Moving a source does not move the table.
+     */
+    class source
+    {
+    private:
+        enum class storage : uint8_t
+        {
+            none,    //< Borrowed memory, not released
+            mapped,  //< Mapped with mmap(2), released with munmap(2)
+            heap     //< Allocated with malloc(3), released with free(3)
+        };
+
+        std::array<std::byte, DMI_ENTRY_POINT_MAX> m_entry;
+        size_t m_entry_size;
+        const std::byte *m_table;
+        size_t m_table_size;
+        void *m_base;
+        size_t m_base_size;
+        storage m_storage;
+
+    public:
+        source() noexcept;
+        source(source&& other) noexcept;
+        source(const source&) = delete;
+        ~source();
+
+        source& operator=(source&& other) noexcept;
+        source& operator=(const source&) = delete;
+
+        /**
+         * @brief Loads the SMBIOS data exported by the kernel via sysfs.
+         *
+         * @details
+         * Reads @ref DMI_SYSFS_ENTRY_POINT and @ref DMI_SYSFS_TABLE under
+         * @p root, which allows a fixture directory to stand in for the
+         * real sysfs.
+         *
+         * @throws std::invalid_argument
+         * @throws std::system_error
+         * @throws std::bad_alloc
+         */
+        static auto open(std::string_view root = DMI_SYSFS_ROOT) -> source;
+
+        /**
+         * @brief Non-throwing open().
+         *
+         * @details
+         * System call failures are reported as @ref errc::io, with `errno`
+         * in error::offset.
+         */
+        static auto try_open(std::string_view root = DMI_SYSFS_ROOT) noexcept
+            -> result<source>;
+
+        /**
+         * @brief Loads the structures of @p types only, one sysfs file per
+         * structure.
+         *
+         * @details
+         * Reads `raw` in @ref DMI_SYSFS_ENTRIES `/<type>-<instance>` under
+         * @p root for each instance until one is missing, typically with
+         * one `open(2)` and one `read(2)` per structure, without reading
+         * the whole table. The structures are gathered into a table of
+         * their own, in the order of @p types, without an entry point.
+         *
+         * @throws std::invalid_argument
+         * @throws std::system_error
+         * @throws std::bad_alloc
+         */
+        static auto open_entries(std::span<const table_type> types,
+            std::string_view root = DMI_SYSFS_ROOT) -> source;
+
+        /**
+         * @brief Non-throwing open_entries().
+         *
+         * @details
+         * System call failures are reported as @ref errc::io, with `errno`
+         * in error::offset, and entries that do not hold a single well-formed
+         * structure as @ref errc::malformed.
+         */
+        static auto try_open_entries(std::span<const table_type> types,
+            std::string_view root = DMI_SYSFS_ROOT) noexcept -> result<source>;
+
+        /**
+         * @brief Wraps a raw SMBIOS dump owned by the caller, whatever its
+         * format.
+         *
+         * @details
+         * Identifies the format with detect_format() and locates the entry
+         * point and the table within @p data without copying the table,
+         * which must outlive the source. Windows `RawSMBIOSData` blobs get
+         * an SMBIOS 3.0 entry point built from their header, bare tables
+         * none.
+         *
+         * @throws std::invalid_argument
+         * @throws std::runtime_error
+         */
+        static auto load(std::span<const std::byte> data) -> source;
+
+        /**
+         * @brief Non-throwing load().
+         *
+         * @details
+         * Reports @ref errc::unknown_format for data in none of the
+         * supported formats, entry point errors as entry::try_create()
+         * does, and @ref errc::malformed for tar archives without a table.
+         */
+        static auto try_load(std::span<const std::byte> data) noexcept
+            -> result<source>;
+
+        /**
+         * @brief Loads a raw SMBIOS dump file, whatever its format.
+         *
+         * @details
+         * Maps the file (or reads it, when it cannot be mapped) and hands
+         * it to load(): the table is used where it lies in the file.
+         *
+         * @throws std::invalid_argument
+         * @throws std::runtime_error
+         * @throws std::system_error
+         * @throws std::bad_alloc
+         */
+        static auto load_file(const char *path) -> source;
+
+        /**
+         * @brief Non-throwing load_file().
+         *
+         * @details
+         * System call failures are reported as @ref errc::io, with `errno`
+         * in error::offset.
+         */
+        static auto try_load_file(const char *path) noexcept -> result<source>;
+
+        /**
+         * @brief Rebuilds the structure table from the text output of
+         * dmidecode.
+         *
+         * @details
+         * Parses the `Handle 0x0001, DMI type 1, 27 bytes` blocks. Those
+         * printed by `dmidecode -u` (and by `dmi-dump`) are rebuilt byte
+         * for byte from their `Header and Data` and `Strings` dumps. Those
+         * printed decoded get a formatted area of the length in their
+         * header, zero-filled (handles set to `FFFFh`), holding the fields
+         * whose `Label: value` line is understood: strings, plain numbers
+         * (with the unit dmidecode prints, if any), handles, values of
+         * enumerations with a name table and the system UUID. Other lines
+         * are ignored, so a decoded import is lossy, but the typed tables
+         * built on it hold what the text says.
+         *
+         * The `SMBIOS 3.2.0 present.` line, if any, gets the table an
+         * SMBIOS 3.0 entry point. The table is copied, @p text need not
+         * outlive the source.
+         *
+         * @throws std::runtime_error
+         * @throws std::bad_alloc
+         */
+        static auto import_text(std::string_view text) -> source;
+
+        /**
+         * @brief Non-throwing import_text().
+         *
+         * @details
+         * Reports @ref errc::unknown_format for text without structures,
+         * @ref errc::malformed (at the offset of the line in @p text) for
+         * a structure header or dump that does not parse, and allocation
+         * failures as @ref errc::io with `ENOMEM` in error::offset.
+         */
+        static auto try_import_text(std::string_view text) noexcept -> result<source>;
+
+        /**
+         * @brief Wraps SMBIOS data owned by the caller.
+         *
+         * @details
+         * The entry point is copied, the table is referenced and must outlive
+         * the source.
+         *
+         * @throws std::invalid_argument
+         */
+        static auto borrow(std::span<const std::byte> entry_point,
+            std::span<const std::byte> table) -> source;
+
+        /**
+         * @brief Non-throwing borrow().
+         */
+        static auto try_borrow(std::span<const std::byte> entry_point,
+            std::span<const std::byte> table) noexcept -> result<source>;
+
+        inline auto entry_point() const -> std::span<const std::byte>
+        {
+            return { m_entry.data(), m_entry_size };
+        }
+
+        inline auto table() const -> std::span<const std::byte>
+        {
+            return { m_table, m_table_size };
+        }
+
+    private:
+        void reset() noexcept;
+    };
+}
+
+#endif // __cplusplus
+
+#endif // !DMI_SOURCE_H
@@ -0,0 +1,153 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_STREAM_H
+#define DMI_STREAM_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+#if defined(__cpp_exceptions)
+#include <stdexcept>
+#endif
+
+#include <dmi/error.h>
+#include <dmi/structure.h>
+
+namespace dmi
+{
+    /**
+     * @brief Incremental parser of an SMBIOS structure table.
+     *
+     * @details
+     * Accepts the table in chunks of any size (pipe reads, network frames,
+     * pieces of a large SMBIOS 3.x table) and emits each structure as soon
+     * as its terminating double NUL arrives, without holding the whole
+     * table in memory.
+     *
+     * Structures that lie entirely within a chunk are emitted in place.
+     * Only a structure split across chunks is copied, into a buffer that
+     * never holds more than that one structure, and reused for the next.
+     *
+     * Like structure_range, the parser skips inactive structures and stops
+     * at the end-of-table structure, ignoring anything after it.
+     *
+     * @code
+     * dmi::stream_parser parser;
+     * while (size_t count = read(fd, buffer, sizeof(buffer)))
+     *     parser.push({ buffer, count }, [](const dmi::structure& structure) { ... });
+     * parser.finish();
+     * @endcode
+     */
+    class stream_parser
+    {
+    private:
+        std::vector<std::byte> m_partial;
+        uint64_t m_offset;
+        bool m_complete;
+        bool m_done;
+
+    public:
+        stream_parser() noexcept;
+
+        /**
+         * @brief Consumes the next structure from @p chunk.
+         *
+         * @details
+         * Advances @p chunk past the bytes consumed. The structure returned
+         * points either into @p chunk or into the parser, and is valid
+         * until the next call.
+         *
+         * @return The next structure, or `std::nullopt` once @p chunk is
+         * exhausted (a partial structure being buffered until the next
+         * chunk) or the end of the table was reached. @ref errc::bad_length
+         * if a structure has a formatted area shorter than its header or a
+         * string set longer than @ref DMI_STRINGS_SIZE_MAX, which bounds
+         * the buffer.
+         *
+         * @throws std::bad_alloc
+         */
+        auto try_next(std::span<const std::byte>& chunk)
+            -> result<std::optional<structure>>;
+
+        /**
+         * @brief Feeds @p chunk to the parser, calling @p emit with every
+         * structure it completes.
+         *
+         * @throws std::runtime_error
+         * @throws std::bad_alloc
+         */
+        template <typename Emit>
+            requires std::is_invocable_v<Emit, const structure&>
+        void push(std::span<const std::byte> chunk, Emit&& emit)
+        {
+            auto result = try_push(chunk, emit);
+            if (!result)
+                DMI_THROW(std::runtime_error("malformed structure"));
+        }
+
+        /**
+         * @brief Non-throwing push().
+         *
+         * @details
+         * The parser stops at the first malformed structure, further
+         * chunks are ignored.
+         *
+         * @throws std::bad_alloc
+         */
+        template <typename Emit>
+            requires std::is_invocable_v<Emit, const structure&>
+        auto try_push(std::span<const std::byte> chunk, Emit&& emit) -> result<void>
+        {
+            for (;;) {
+                auto structure = try_next(chunk);
+                if (!structure)
+                    return std::unexpected(structure.error());
+                if (!*structure)
+                    return {};
+
+                emit(**structure);
+            }
+        }
+
+        /**
+         * @brief Checks that the stream did not end in the middle of a
+         * structure.
+         *
+         * @throws std::runtime_error
+         */
+        void finish() const;
+
+        /**
+         * @brief Non-throwing finish().
+         *
+         * @return @ref errc::truncated at the offset of the partial
+         * structure.
+         */
+        auto try_finish() const noexcept -> result<void>;
+
+        /**
+         * @brief Whether the end-of-table structure (or a malformed one) was
+         * reached.
+         */
+        inline bool done() const { return m_done; }
+
+        /**
+         * @brief Offset of the next structure from the start of the stream.
+         */
+        inline uint64_t offset() const { return m_offset; }
+
+        /**
+         * @brief Number of bytes of the partial structure being buffered.
+         */
+        inline size_t pending() const { return m_complete ? 0 : m_partial.size(); }
+    };
+}
+
+#endif // !DMI_STREAM_H
@@ -0,0 +1,68 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_STRINGS_H
+#define DMI_STRINGS_H
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include <dmi/types.h>
+
+/**
+ * @brief Maximum number of strings a structure can reference.
+ *
+ * @details
+ * Strings are referenced by 1-based 8-bit numbers, `0` meaning no string.
+ */
+#define DMI_STRINGS_MAX 255
+
+/**
+ * @brief Maximum size of a string set handled by dmi::scan_strings().
+ */
+#define DMI_STRINGS_SIZE_MAX 0xFFFF
+
+namespace dmi
+{
+    /**
+     * @brief Result of scan_strings().
+     */
+    struct string_scan
+    {
+        /**
+         * @brief Size of the string set, including the terminating double NUL,
+         * or `0` if it is not terminated.
+         */
+        size_t size;
+
+        /**
+         * @brief Number of strings in the set.
+         *
+         * @details
+         * May exceed the capacity of the offset buffer, in which case only
+         * the first offsets have been stored.
+         */
+        size_t count;
+    };
+
+    /**
+     * @brief Scans a string set in a single pass.
+     *
+     * @details
+     * Finds the double NUL that terminates the string set at the start of
+     * @p data and, in the same pass, stores the offset (relative to the start
+     * of @p data) of every string into @p offsets, so that looking a string up
+     * by number is a plain array access afterwards.
+     *
+     * At most @ref DMI_STRINGS_SIZE_MAX bytes are scanned, which keeps offsets
+     * in 16 bits. The scan runs with AVX2 or SSE2 on x86, NEON on ARM, and a
+     * portable loop with the same results elsewhere.
+     */
+    auto scan_strings(std::span<const std::byte> data,
+        std::span<uint16_t> offsets) noexcept -> string_scan;
+}
+
+#endif // !DMI_STRINGS_H
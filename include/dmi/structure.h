@@ -0,0 +1,421 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_STRUCTURE_H
+#define DMI_STRUCTURE_H
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <dmi/types.h>
+#include <dmi/field.h>
+#include <dmi/strings.h>
+#include <dmi/table.h>
+
+namespace dmi
+{
+    namespace detail
+    {
+        /**
+         * @brief Measures the structure at @p ptr.
+         *
+         * @details
+         * A structure is its formatted area (`dmi_header::length` bytes,
+         * starting with the header) followed by a string set terminated by
+         * a double NUL, which is present even when there are no strings.
+         *
+         * String sets longer than @ref DMI_STRINGS_SIZE_MAX are malformed,
+         * as the directory cannot index them.
+         *
+         * @return Total size of the structure, in bytes, or `0` if it is
+         * malformed or does not fit before @p end.
+         */
+        constexpr size_t structure_size(const std::byte *ptr,
+            const std::byte *end) noexcept
+        {
+            size_t avail = size_t(end - ptr);
+            if (avail < sizeof(dmi_header_t) + 2)
+                return 0;
+
+            size_t length = uint8_t(ptr[1]);
+            if (length < sizeof(dmi_header_t) || length + 2 > avail)
+                return 0;
+            if (avail - length > DMI_STRINGS_SIZE_MAX)
+                end = ptr + length + DMI_STRINGS_SIZE_MAX;
+
+            const std::byte *pos = ptr + length;
+            bool carry = false;
+
+            if consteval {
+                for (; pos < end; pos++) {
+                    bool zero = *pos == std::byte(0);
+                    if (carry && zero)
+                        return size_t(pos + 1 - ptr);
+                    carry = zero;
+                }
+
+                return 0;
+            }
+
+            // Eight bytes at a time: flag the zero bytes of a word, then the
+            // zero bytes followed by another one, carrying the last flag over
+            // to the next word.
+            for (; end - pos >= 8; pos += 8) {
+                uint64_t word;
+                std::memcpy(&word, pos, sizeof(word));
+                if constexpr (std::endian::native == std::endian::big)
+                    word = __builtin_bswap64(word);
+
+                constexpr uint64_t low = 0x7F7F7F7F7F7F7F7Full;
+                uint64_t zero = ~(((word & low) + low) | word | low);
+
+                if (carry && (zero & 0x80) != 0)
+                    return size_t(pos + 1 - ptr);
+
+                uint64_t pair = zero & (zero >> 8);
+                if (pair != 0)
+                    return size_t(pos + (__builtin_ctzll(pair) >> 3) + 2 - ptr);
+
+                carry = (zero >> 63) != 0;
+            }
+
+            for (; pos < end; pos++) {
+                bool zero = *pos == std::byte(0);
+                if (carry && zero)
+                    return size_t(pos + 1 - ptr);
+                carry = zero;
+            }
+
+            return 0;
+        }
+    }
+
+    /**
+     * @brief View of a single SMBIOS structure.
+     *
+     * @details
+     * Points into the buffer the structure was found in, which must outlive
+     * the view.
+     */
+    class structure
+    {
+    private:
+        const std::byte *m_data;
+        size_t m_size;
+        const uint16_t *m_strings;
+        size_t m_string_count;
+
+    public:
+        constexpr structure() noexcept
+            : m_data(nullptr),
+              m_size(0),
+              m_strings(nullptr),
+              m_string_count(0)
+        {
+        }
+
+        constexpr structure(const std::byte *data, size_t size) noexcept
+            : m_data(data),
+              m_size(size),
+              m_strings(nullptr),
+              m_string_count(0)
+        {
+        }
+
+        /**
+         * @brief Creates a view with a precomputed string index.
+         *
+         * @details
+         * @p strings holds the offset of each string relative to the start
+         * of the string set, as produced by scan_strings().
+         */
+        constexpr structure(const std::byte *data, size_t size, const uint16_t *strings,
+            size_t string_count) noexcept
+            : m_data(data),
+              m_size(size),
+              m_strings(strings),
+              m_string_count(string_count)
+        {
+        }
+
+        inline const dmi::header& header() const
+        {
+            return *reinterpret_cast<const dmi::header *>(m_data);
+        }
+
+        constexpr table_type type() const { return table_type(m_data[0]); }
+        constexpr uint8_t length() const { return uint8_t(m_data[1]); }
+        constexpr handle_t handle() const { return DMI_FIELD(m_data, dmi_header_t, handle); }
+
+        /**
+         * @brief Whole structure, formatted area and string set.
+         */
+        constexpr auto data() const -> std::span<const std::byte>
+        {
+            return { m_data, m_size };
+        }
+
+        /**
+         * @brief Formatted area, starting with the header.
+         */
+        constexpr auto formatted() const -> std::span<const std::byte>
+        {
+            return { m_data, length() };
+        }
+
+        /**
+         * @brief Checks whether the formatted area covers @p size bytes at
+         * @p offset, i.e. whether a field is present in this structure.
+         */
+        constexpr bool covers(size_t offset, size_t size) const
+        {
+            return offset + size <= length();
+        }
+
+        /**
+         * @brief String set, including the terminating double NUL.
+         */
+        constexpr auto strings() const -> std::span<const std::byte>
+        {
+            return { m_data + length(), m_size - length() };
+        }
+
+        /**
+         * @brief Number of strings in the string index, `0` for views without
+         * one.
+         */
+        constexpr size_t string_count() const { return m_string_count; }
+
+        /**
+         * @brief Looks up a string by its 1-based number.
+         *
+         * @details
+         * Constant time for views with a string index (e.g. obtained from a
+         * directory), a scan of the string set otherwise.
+         *
+         * @return The string, or an empty view if @p index is `0` (no string)
+         * or out of range.
+         */
+        inline std::string_view string(uint8_t index) const
+        {
+            auto value = string_bytes(index);
+            return { reinterpret_cast<const char *>(value.data()), value.size() };
+        }
+
+        /**
+         * @brief Looks up a string by its 1-based number, as bytes.
+         *
+         * @details
+         * Same as string(), but usable in constant expressions, where bytes
+         * cannot be viewed as characters; see dmi::string_equal().
+         */
+        constexpr auto string_bytes(uint8_t index) const -> std::span<const std::byte>
+        {
+            if (index == 0)
+                return {};
+
+            auto set = strings();
+
+            if (m_strings != nullptr) {
+                if (index > m_string_count)
+                    return {};
+
+                size_t offset = m_strings[index - 1];
+                size_t size = index < m_string_count ?
+                    size_t(m_strings[index]) - offset - 1 : length_of(set.subspan(offset));
+
+                return set.subspan(offset, size);
+            }
+
+            size_t pos = 0;
+
+            for (; pos + 1 < set.size() && set[pos] != std::byte(0); index--) {
+                size_t size = length_of(set.subspan(pos));
+                if (index == 1)
+                    return set.subspan(pos, size);
+                pos += size + 1;
+            }
+
+            return {};
+        }
+
+    private:
+        /**
+         * @brief Length of the NUL-terminated string at the start of @p data.
+         */
+        static constexpr size_t length_of(std::span<const std::byte> data) noexcept
+        {
+            if !consteval {
+                return std::strlen(reinterpret_cast<const char *>(data.data()));
+            }
+
+            size_t size = 0;
+            while (data[size] != std::byte(0))
+                size++;
+            return size;
+        }
+    };
+
+    /**
+     * @brief Compares the bytes of a string from a structure to @p value.
+     *
+     * @details
+     * Usable in constant expressions, e.g. to check embedded fixtures with
+     * `static_assert`.
+     */
+    constexpr bool string_equal(std::span<const std::byte> bytes,
+        std::string_view value) noexcept
+    {
+        if (bytes.size() != value.size())
+            return false;
+
+        for (size_t i = 0; i < bytes.size(); i++) {
+            if (bytes[i] != std::byte(value[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Converts an embedded blob (e.g. from `#embed` or `xxd -i`) into
+     * bytes usable by the walker and the views in constant expressions.
+     */
+    template <typename T, size_t N>
+        requires (sizeof(T) == 1 && std::is_trivially_copyable_v<T>)
+    constexpr auto to_bytes(const T (&data)[N]) noexcept -> std::array<std::byte, N>
+    {
+        return std::bit_cast<std::array<std::byte, N>>(data);
+    }
+
+    /**
+     * @brief Forward iterator over the structures of a table.
+     *
+     * @details
+     * Inactive structures (type 126) are skipped, the walk stops at the
+     * end-of-table structure (type 127), at the end of the buffer or at the
+     * first malformed structure, whichever comes first.
+     */
+    class structure_iterator
+    {
+    private:
+        const std::byte *m_ptr;
+        const std::byte *m_end;
+        size_t m_size;
+
+    public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = structure;
+        using difference_type   = std::ptrdiff_t;
+
+        constexpr structure_iterator() noexcept
+            : m_ptr(nullptr),
+              m_end(nullptr),
+              m_size(0)
+        {
+        }
+
+        constexpr structure_iterator(const std::byte *ptr, const std::byte *end) noexcept
+            : m_ptr(ptr),
+              m_end(end),
+              m_size(0)
+        {
+            settle();
+        }
+
+        constexpr structure operator*() const { return { m_ptr, m_size }; }
+
+        constexpr structure_iterator& operator++() noexcept
+        {
+            m_ptr += m_size;
+            settle();
+            return *this;
+        }
+
+        constexpr structure_iterator operator++(int) noexcept
+        {
+            structure_iterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        constexpr bool operator==(const structure_iterator& other) const noexcept
+        {
+            return m_ptr == other.m_ptr;
+        }
+
+        constexpr bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return m_ptr == nullptr;
+        }
+
+    private:
+        /**
+         * @brief Measures the structure at the current position, skipping
+         * inactive ones, and turns into the end iterator when done.
+         */
+        constexpr void settle() noexcept
+        {
+            for (;;) {
+                m_size = m_ptr != nullptr ?
+                    detail::structure_size(m_ptr, m_end) : 0;
+
+                uint8_t type = m_size != 0 ?
+                    uint8_t(m_ptr[0]) : uint8_t(DMI_TABLE_END_OF_TABLE);
+
+                if (type == DMI_TABLE_END_OF_TABLE) [[unlikely]] {
+                    m_ptr = nullptr;
+                    m_size = 0;
+                    return;
+                }
+                if (type != DMI_TABLE_INACTIVE) [[likely]]
+                    return;
+
+                m_ptr += m_size;
+            }
+        }
+    };
+
+    /**
+     * @brief Range of the structures of a table.
+     *
+     * @details
+     * Lightweight view over a table buffer, compatible with the standard
+     * range adaptors (e.g. `std::views::filter` and `std::views::take`).
+     *
+     * @see structure_iterator
+     */
+    class structure_range : public std::ranges::view_interface<structure_range>
+    {
+    private:
+        std::span<const std::byte> m_table;
+
+    public:
+        constexpr structure_range() noexcept = default;
+
+        constexpr explicit structure_range(std::span<const std::byte> table) noexcept
+            : m_table(table)
+        {
+        }
+
+        constexpr structure_iterator begin() const
+        {
+            return { m_table.data(), m_table.data() + m_table.size() };
+        }
+
+        constexpr std::default_sentinel_t end() const { return {}; }
+    };
+}
+
+#endif // !DMI_STRUCTURE_H
@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <vector>
 #include <string>
+#include <string_view>
 
 #include <dmi/types.h>
+#include <dmi/enum.h>
 
 typedef enum dmi_table_type : uint8_t
 {
@@ -128,18 +132,153 @@ namespace dmi
         end_of_table              = DMI_TABLE_END_OF_TABLE
     };
 
-    const std::string_view to_string(table_type value);
+    namespace detail
+    {
+        inline constexpr name_entry table_type_entries[] = {
+            { DMI_TABLE_BIOS,                      "BIOS information" },
+            { DMI_TABLE_SYSTEM,                    "System information" },
+            { DMI_TABLE_BASEBOARD,                 "Baseboard or module information" },
+            { DMI_TABLE_CHASSIS,                   "System enclosure or chassis" },
+            { DMI_TABLE_PROCESSOR,                 "Processor information" },
+            { DMI_TABLE_MEMORY_CONTROLLER,         "Memory controller information" },
+            { DMI_TABLE_MEMORY_MODULE,             "Memory module information" },
+            { DMI_TABLE_CACHE,                     "Cache information" },
+            { DMI_TABLE_PORT_CONNECTOR,            "Port connector information" },
+            { DMI_TABLE_SYSTEM_SLOTS,              "System slots" },
+            { DMI_TABLE_ONBOARD_DEVICE,            "Onboard devices information" },
+            { DMI_TABLE_OEM_STRINGS,               "OEM strings" },
+            { DMI_TABLE_SYSTEM_CONFIG,             "System configuration options" },
+            { DMI_TABLE_BIOS_LANGUAGE,             "BIOS language information" },
+            { DMI_TABLE_GROUP_ASSOC,               "Group associations" },
+            { DMI_TABLE_SYSTEM_EVENT_LOG,          "System event log" },
+            { DMI_TABLE_MEMORY_PHYS_ARRAY,         "Physical memory array" },
+            { DMI_TABLE_MEMORY_DEVICE,             "Memory device" },
+            { DMI_TABLE_MEMORY_ERROR_32BIT,        "32-bit memory error information" },
+            { DMI_TABLE_MEMORY_ARRAY_MAPPED_ADDR,  "Memory array mapped address" },
+            { DMI_TABLE_MEMORY_DEVICE_MAPPED_ADDR, "Memory device mapped address" },
+            { DMI_TABLE_POINTING_DEVICE,           "Built-in pointing device" },
+            { DMI_TABLE_PORTABLE_BATTERY,          "Portable battery" },
+            { DMI_TABLE_SYSTEM_RESET,              "System reset" },
+            { DMI_TABLE_HARDWARE_SECURITY,         "Hardware security" },
+            { DMI_TABLE_SYSTEM_POWER_CONTROLS,     "System power controls" },
+            { DMI_TABLE_VOLTAGE_PROBE,             "Voltage probe" },
+            { DMI_TABLE_COOLING_DEVICE,            "Cooling device" },
+            { DMI_TABLE_TEMPERATURE_PROBE,         "Temperature probe" },
+            { DMI_TABLE_CURRENT_PROBE,             "Electrical current probe" },
+            { DMI_TABLE_OOB_REMOTE_ACCESS,         "Out-of-band remote access" },
+            { DMI_TABLE_BOOT_INTEGRITY,            "Boot Integrity Services (BIS) entry point" },
+            { DMI_TABLE_SYSTEM_BOOT,               "System boot information" },
+            { DMI_TABLE_MEMORY_ERROR_64BIT,        "64-bit memory error information" },
+            { DMI_TABLE_MGMT_DEVICE,               "Management device" },
+            { DMI_TABLE_MGMT_DEVICE_COMPONENT,     "Management device component" },
+            { DMI_TABLE_MGMT_DEVICE_THRESHOLD,     "Management device threshold data" },
+            { DMI_TABLE_MEMORY_CHANNEL,            "Memory channel" },
+            { DMI_TABLE_IPMI_DEVICE,               "IPMI device information" },
+            { DMI_TABLE_POWER_SUPPLY,              "System power supply" },
+            { DMI_TABLE_ADDITIONAL_INFO,           "Additional information" },
+            { DMI_TABLE_ONBOARD_DEVICE_EX,         "Onboard devices extended information" },
+            { DMI_TABLE_MGMT_CONTROLLER_HOST_IF,   "Management controller host interface" },
+            { DMI_TABLE_TPM_DEVICE,                "TPM device" },
+            { DMI_TABLE_PROCESSOR_EX,              "Processor additional information" },
+            { DMI_TABLE_FIRMWARE,                  "Firmware inventory information" },
+            { DMI_TABLE_STRING_PROPERTY,           "String property" }
+        };
+
+        inline constexpr auto& table_type_names = names<47, table_type_entries>;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(table_type value) noexcept -> result<std::string_view>
+    {
+        return detail::try_name(detail::table_type_names, value);
+    }
+
+    /**
+     * @throws std::invalid_argument
+     */
+    constexpr std::string_view to_string(table_type value)
+    {
+        return detail::to_name(detail::table_type_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(table_type) noexcept
+    {
+        return detail::table_type_names;
+    }
 
+    /**
+     * @brief String of a table stored by a context.
+     *
+     * @details
+     * Offset and size of the string in the string blob of the stored tables
+     * of its type, see dmi::stored_tables::string().
+     */
+    struct string_ref
+    {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Keeps the decoded strings as `std::string` copies.
+         */
+        struct copy_strings
+        {
+            inline std::string operator()(std::string_view value) const
+            {
+                return std::string(value);
+            }
+
+            inline std::optional<std::string> operator()(std::optional<std::string_view> value) const
+            {
+                if (!value)
+                    return std::nullopt;
+
+                return std::string(*value);
+            }
+        };
+    }
+
+    /**
+     * @brief Base of the decoded tables.
+     *
+     * @details
+     * Not polymorphic: decoded tables are plain values without a vtable
+     * pointer. The destructor is protected so that they cannot be deleted
+     * through a pointer to the base.
+     *
+     * Each decoded table is a template over the type of its strings:
+     * `std::string` for the owning table (e.g. dmi::table::system), and
+     * dmi::string_ref for the trivially destructible record a context
+     * stores contiguously by type (e.g. dmi::table::system_record, see
+     * dmi::context::tables()).
+     */
     class basic_table
     {
     protected:
         handle_t m_handle;
 
-    public:
-        basic_table();
-        virtual ~basic_table();
+        constexpr basic_table() noexcept
+            : m_handle(0xFFFF)
+        {
+        }
+
+        constexpr explicit basic_table(handle_t handle) noexcept
+            : m_handle(handle)
+        {
+        }
 
-        inline handle_t handle() const { return m_handle; }
+        ~basic_table() = default;
+
+    public:
+        constexpr handle_t handle() const { return m_handle; }
     };
 }
 
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Additional information (type 40).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/additional-info.h>
+
 #endif // !DMI_TABLE_ADDITIONAL_INFO_H
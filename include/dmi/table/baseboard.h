@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Baseboard information (type 2).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/baseboard.h>
+
 #endif // !DMI_TABLE_BASEBOARD_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief BIOS language information (type 13).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/bios-language.h>
+
 #endif // !DMI_TABLE_BIOS_LANGUAGE_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief BIOS information (type 0).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/bios.h>
+
 #endif // !DMI_TABLE_BIOS_H
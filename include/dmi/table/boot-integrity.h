@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Boot integrity services entry point (type 31).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/boot-integrity.h>
+
 #endif // !DMI_TABLE_BOOT_INTEGRITY_H
@@ -8,6 +8,16 @@
 #pragma once
 
 #include <dmi/table.h>
+#include <dmi/decode.h>
+#include <dmi/field.h>
+#include <dmi/structure.h>
+#include <dmi/version.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
 
 /**
  * @brief Logical cache types.
@@ -388,12 +398,151 @@ struct dmi_cache_table
  */
 typedef struct dmi_cache_table dmi_cache_table_t;
 
+static_assert(offsetof(dmi_cache_table_t, config) == 0x05);
+static_assert(offsetof(dmi_cache_table_t, maximum_size) == 0x07);
+static_assert(offsetof(dmi_cache_table_t, installed_size) == 0x09);
+static_assert(offsetof(dmi_cache_table_t, supported_sram) == 0x0B);
+static_assert(offsetof(dmi_cache_table_t, installed_sram) == 0x0D);
+static_assert(offsetof(dmi_cache_table_t, speed) == 0x0F);
+static_assert(offsetof(dmi_cache_table_t, associativity) == 0x12);
+static_assert(offsetof(dmi_cache_table_t, maximum_size_2) == 0x13);
+static_assert(offsetof(dmi_cache_table_t, installed_size_2) == 0x17);
+
 #ifdef __cplusplus
 
 namespace dmi::table
 {
-    using cache_size    = ::dmi_cache_size_t;
-    using cache_size_ex = ::dmi_cache_size_ex_t;
+    /**
+     * @brief Cache location, relative to the CPU module.
+     */
+    enum class cache_location : uint8_t
+    {
+        internal = DMI_CACHE_LOCATION_INTERNAL, //< Internal
+        external = DMI_CACHE_LOCATION_EXTERNAL, //< External
+        reserved = DMI_CACHE_LOCATION_RESERVED, //< Reserved
+        unknown  = DMI_CACHE_LOCATION_UNKNOWN   //< Unknown
+    };
+
+    /**
+     * @brief Cache operational mode.
+     */
+    enum class cache_mode : uint8_t
+    {
+        write_through = DMI_CACHE_MODE_WRITE_THROUGH, //< Write-through
+        write_back    = DMI_CACHE_MODE_WRITE_BACK,    //< Write-back
+        variable      = DMI_CACHE_MODE_VARIABLE,      //< Varies with memory address
+        unknown       = DMI_CACHE_MODE_UNKNOWN        //< Unknown
+    };
+
+    /**
+     * @brief Cache size.
+     *
+     * @details
+     * Portable decoding of ::dmi_cache_size_t.
+     */
+    class cache_size
+    {
+    private:
+        uint16_t m_value;
+
+    public:
+        constexpr cache_size() noexcept : m_value(0) {}
+        constexpr explicit cache_size(uint16_t value) noexcept : m_value(value) {}
+
+        constexpr uint16_t value() const { return m_value; }
+        constexpr uint16_t size() const { return bits<0, 15>(m_value); }
+        constexpr bool granularity() const { return flag<15>(m_value); }
+
+        /**
+         * @brief Size in KiB.
+         */
+        constexpr uint64_t kilobytes() const
+        {
+            return uint64_t(size()) << (granularity() ? 6 : 0);
+        }
+    };
+
+    /**
+     * @brief Extended cache size.
+     *
+     * @details
+     * Portable decoding of ::dmi_cache_size_ex_t.
+     */
+    class cache_size_ex
+    {
+    private:
+        uint32_t m_value;
+
+    public:
+        constexpr cache_size_ex() noexcept : m_value(0) {}
+        constexpr explicit cache_size_ex(uint32_t value) noexcept : m_value(value) {}
+
+        constexpr uint32_t value() const { return m_value; }
+        constexpr uint32_t size() const { return bits<0, 31>(m_value); }
+        constexpr bool granularity() const { return flag<31>(m_value); }
+
+        /**
+         * @brief Size in KiB.
+         */
+        constexpr uint64_t kilobytes() const
+        {
+            return uint64_t(size()) << (granularity() ? 6 : 0);
+        }
+    };
+
+    /**
+     * @brief Cache configuration.
+     *
+     * @details
+     * Portable decoding of ::dmi_cache_config_t.
+     */
+    class cache_config
+    {
+    private:
+        uint16_t m_value;
+
+    public:
+        constexpr cache_config() noexcept : m_value(0) {}
+        constexpr explicit cache_config(uint16_t value) noexcept : m_value(value) {}
+
+        constexpr uint16_t value() const { return m_value; }
+
+        /**
+         * @brief Cache level, 1 through 8.
+         */
+        constexpr unsigned level() const { return bits<0, 3>(m_value) + 1u; }
+
+        constexpr bool socketed() const { return flag<3>(m_value); }
+        constexpr cache_location location() const { return cache_location(bits<5, 2>(m_value)); }
+        constexpr bool enabled() const { return flag<7>(m_value); }
+        constexpr cache_mode mode() const { return cache_mode(bits<8, 2>(m_value)); }
+    };
+
+    /**
+     * @brief Cache SRAM types.
+     *
+     * @details
+     * Portable decoding of ::dmi_cache_sram_t.
+     */
+    class cache_sram
+    {
+    private:
+        uint16_t m_value;
+
+    public:
+        constexpr cache_sram() noexcept : m_value(0) {}
+        constexpr explicit cache_sram(uint16_t value) noexcept : m_value(value) {}
+
+        constexpr uint16_t value() const { return m_value; }
+        constexpr bool other() const { return flag<0>(m_value); }
+        constexpr bool unknown() const { return flag<1>(m_value); }
+        constexpr bool non_burst() const { return flag<2>(m_value); }
+        constexpr bool burst() const { return flag<3>(m_value); }
+        constexpr bool pipeline_burst() const { return flag<4>(m_value); }
+        constexpr bool synchronous() const { return flag<5>(m_value); }
+        constexpr bool asynchronous() const { return flag<6>(m_value); }
+    };
+
     /**
      * @brief Logical cache types.
      *
@@ -448,6 +597,297 @@ namespace dmi::table
         single_bit  = DMI_CACHE_ECC_SINGLE_BIT,  //< Single-bit ECC
         multi_bit   = DMI_CACHE_ECC_MULTI_BIT    //< Multi-bit ECC
     };
+
+    /**
+     * @brief Cache information fields, for use with dmi::decode().
+     */
+    enum class cache_field : uint16_t
+    {
+        socket_designation = 1 << 0,
+        config             = 1 << 1,
+        maximum_size       = 1 << 2,
+        installed_size     = 1 << 3,
+        supported_sram     = 1 << 4,
+        installed_sram     = 1 << 5,
+        speed              = 1 << 6,
+        ecc_type           = 1 << 7,
+        type               = 1 << 8,
+        associativity      = 1 << 9,
+        maximum_size_2     = 1 << 10,
+        installed_size_2   = 1 << 11,
+        all                = 0x0FFF
+    };
+
+    DMI_FIELD_MASK(cache_field)
+
+    template <typename String>
+    class basic_cache;
+
+    using cache = basic_cache<std::string>;
+    using cache_record = basic_cache<dmi::string_ref>;
+
+    /**
+     * @brief Length of the cache information structure guaranteed by SMBIOS @p version.
+     */
+    constexpr size_t cache_length(const version_id& version) noexcept
+    {
+        if (version >= smbios_3_1)
+            return offsetof(dmi_cache_table, installed_size_2) + sizeof(dmi_cache_size_ex_t);
+        if (version >= smbios_2_1)
+            return offsetof(dmi_cache_table, associativity) + 1;
+        if (version >= smbios_2_0)
+            return offsetof(dmi_cache_table, installed_sram) + sizeof(dmi_cache_sram_t);
+
+        return sizeof(dmi_header_t);
+    }
+
+    /**
+     * @brief Cache information view.
+     *
+     * @details
+     * Zero-copy view of a cache information structure, tied to the lifetime
+     * of the context it was obtained from. Fields introduced after SMBIOS 2.0
+     * are empty when the structure is too short to hold them.
+     *
+     * Fields that SMBIOS @p Min guarantees are read without a length check,
+     * the structure must be at least @ref min_length bytes long.
+     */
+    template <version_id Min = smbios_any>
+    class basic_cache_view
+    {
+    private:
+        dmi::structure m_structure;
+
+    public:
+        static constexpr version_id min_version = Min;
+        static constexpr size_t min_length = cache_length(Min);
+
+        /**
+         * @brief Offsets of the string number fields.
+         */
+        static constexpr std::array<size_t, 1> string_fields = { offsetof(dmi_cache_table, socket_designation) };
+
+        /**
+         * @param structure Cache information structure.
+         */
+        constexpr explicit basic_cache_view(const dmi::structure& structure)
+            : m_structure(structure)
+        {
+        }
+
+        constexpr handle_t handle() const { return m_structure.handle(); }
+        constexpr const dmi::structure& structure() const { return m_structure; }
+
+        inline std::string_view socket_designation() const
+        {
+            if (!has(offsetof(dmi_cache_table, socket_designation), 1))
+                return {};
+
+            return m_structure.string(DMI_FIELD(base(), dmi_cache_table, socket_designation));
+        }
+
+        constexpr cache_config config() const
+        {
+            if (!has(offsetof(dmi_cache_table, config), sizeof(uint16_t)))
+                return {};
+
+            return cache_config(load<uint16_t>(base() + offsetof(dmi_cache_table, config)));
+        }
+
+        constexpr cache_size maximum_size() const
+        {
+            if (!has(offsetof(dmi_cache_table, maximum_size), sizeof(uint16_t)))
+                return {};
+
+            return cache_size(load<uint16_t>(base() + offsetof(dmi_cache_table, maximum_size)));
+        }
+
+        constexpr cache_size installed_size() const
+        {
+            if (!has(offsetof(dmi_cache_table, installed_size), sizeof(uint16_t)))
+                return {};
+
+            return cache_size(load<uint16_t>(base() + offsetof(dmi_cache_table, installed_size)));
+        }
+
+        constexpr cache_sram supported_sram() const
+        {
+            if (!has(offsetof(dmi_cache_table, supported_sram), sizeof(uint16_t)))
+                return {};
+
+            return cache_sram(load<uint16_t>(base() + offsetof(dmi_cache_table, supported_sram)));
+        }
+
+        constexpr cache_sram installed_sram() const
+        {
+            if (!has(offsetof(dmi_cache_table, installed_sram), sizeof(uint16_t)))
+                return {};
+
+            return cache_sram(load<uint16_t>(base() + offsetof(dmi_cache_table, installed_sram)));
+        }
+
+        constexpr std::optional<uint8_t> speed() const
+        {
+            if (!has(offsetof(dmi_cache_table, speed), 1))
+                return std::nullopt;
+
+            return DMI_FIELD(base(), dmi_cache_table, speed);
+        }
+
+        constexpr std::optional<cache_ecc> ecc_type() const
+        {
+            if (!has(offsetof(dmi_cache_table, ecc_type), 1))
+                return std::nullopt;
+
+            return cache_ecc(DMI_FIELD(base(), dmi_cache_table, ecc_type));
+        }
+
+        constexpr std::optional<cache_type> type() const
+        {
+            if (!has(offsetof(dmi_cache_table, type), 1))
+                return std::nullopt;
+
+            return cache_type(DMI_FIELD(base(), dmi_cache_table, type));
+        }
+
+        constexpr std::optional<cache_assoc> associativity() const
+        {
+            if (!has(offsetof(dmi_cache_table, associativity), 1))
+                return std::nullopt;
+
+            return cache_assoc(DMI_FIELD(base(), dmi_cache_table, associativity));
+        }
+
+        constexpr std::optional<cache_size_ex> maximum_size_2() const
+        {
+            if (!has(offsetof(dmi_cache_table, maximum_size_2), sizeof(uint32_t)))
+                return std::nullopt;
+
+            return cache_size_ex(load<uint32_t>(base() + offsetof(dmi_cache_table, maximum_size_2)));
+        }
+
+        constexpr std::optional<cache_size_ex> installed_size_2() const
+        {
+            if (!has(offsetof(dmi_cache_table, installed_size_2), sizeof(uint32_t)))
+                return std::nullopt;
+
+            return cache_size_ex(load<uint32_t>(base() + offsetof(dmi_cache_table, installed_size_2)));
+        }
+
+        /**
+         * @brief Makes an owning copy of the structure.
+         */
+        cache materialize() const;
+
+    private:
+        constexpr const std::byte *base() const
+        {
+            return m_structure.data().data();
+        }
+
+        constexpr bool has(size_t offset, size_t size) const
+        {
+            return offset + size <= min_length || m_structure.covers(offset, size);
+        }
+    };
+
+    using cache_view = basic_cache_view<>;
+
+    template <typename String>
+    class basic_cache : public dmi::basic_table
+    {
+    private:
+        String m_socket_designation;
+        cache_config m_config;
+        cache_size m_maximum_size;
+        cache_size m_installed_size;
+        cache_sram m_supported_sram;
+        cache_sram m_installed_sram;
+        std::optional<uint8_t> m_speed;
+        std::optional<cache_ecc> m_ecc_type;
+        std::optional<cache_type> m_type;
+        std::optional<cache_assoc> m_associativity;
+        std::optional<cache_size_ex> m_maximum_size_2;
+        std::optional<cache_size_ex> m_installed_size_2;
+        cache_field m_fields;
+
+    public:
+        static constexpr dmi::table_type structure_type = table_type::cache;
+
+        using view_type = cache_view;
+        using field_type = cache_field;
+
+        template <version_id Min>
+        using view_at = basic_cache_view<Min>;
+
+        /**
+         * @brief Versions at which fields were added.
+         */
+        static constexpr std::array versions = { smbios_any, smbios_2_0, smbios_2_1, smbios_3_1 };
+
+        /**
+         * @brief Decodes the @p fields of @p view.
+         *
+         * @details
+         * Fields that are not selected are left empty (or zero). Strings
+         * are kept as @p strings returns them.
+         */
+        template <version_id Min, typename Strings = dmi::detail::copy_strings>
+        explicit basic_cache(const basic_cache_view<Min>& view,
+            cache_field fields = cache_field::all, Strings&& strings = {})
+            : basic_table(view.handle()),
+              m_fields(fields)
+        {
+            if (has_field(fields, cache_field::socket_designation))
+                m_socket_designation = strings(view.socket_designation());
+            if (has_field(fields, cache_field::config))
+                m_config = view.config();
+            if (has_field(fields, cache_field::maximum_size))
+                m_maximum_size = view.maximum_size();
+            if (has_field(fields, cache_field::installed_size))
+                m_installed_size = view.installed_size();
+            if (has_field(fields, cache_field::supported_sram))
+                m_supported_sram = view.supported_sram();
+            if (has_field(fields, cache_field::installed_sram))
+                m_installed_sram = view.installed_sram();
+            if (has_field(fields, cache_field::speed))
+                m_speed = view.speed();
+            if (has_field(fields, cache_field::ecc_type))
+                m_ecc_type = view.ecc_type();
+            if (has_field(fields, cache_field::type))
+                m_type = view.type();
+            if (has_field(fields, cache_field::associativity))
+                m_associativity = view.associativity();
+            if (has_field(fields, cache_field::maximum_size_2))
+                m_maximum_size_2 = view.maximum_size_2();
+            if (has_field(fields, cache_field::installed_size_2))
+                m_installed_size_2 = view.installed_size_2();
+        }
+
+        /**
+         * @brief Fields that were decoded.
+         */
+        inline cache_field fields() const { return m_fields; }
+
+        inline const String& socket_designation() const { return m_socket_designation; }
+        inline cache_config config() const { return m_config; }
+        inline cache_size maximum_size() const { return m_maximum_size; }
+        inline cache_size installed_size() const { return m_installed_size; }
+        inline cache_sram supported_sram() const { return m_supported_sram; }
+        inline cache_sram installed_sram() const { return m_installed_sram; }
+        inline const std::optional<uint8_t>& speed() const { return m_speed; }
+        inline const std::optional<cache_ecc>& ecc_type() const { return m_ecc_type; }
+        inline const std::optional<cache_type>& type() const { return m_type; }
+        inline const std::optional<cache_assoc>& associativity() const { return m_associativity; }
+        inline const std::optional<cache_size_ex>& maximum_size_2() const { return m_maximum_size_2; }
+        inline const std::optional<cache_size_ex>& installed_size_2() const { return m_installed_size_2; }
+    };
+
+    template <version_id Min>
+    inline cache basic_cache_view<Min>::materialize() const
+    {
+        return cache(*this);
+    }
 }
 
 #endif // __cplusplus
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <dmi/table.h>
+#include <dmi/enum.h>
 
 /**
  * @brief System enclosure or chassis types.
@@ -130,17 +131,115 @@ namespace dmi::table
         non_recoverable = DMI_CHASSIS_STATE_NON_RECOVERABLE //< Non-recoverable
     };
 
+    namespace detail
+    {
+        inline constexpr dmi::detail::name_entry chassis_type_entries[] = {
+            { DMI_CHASSIS_TYPE_UNSPECIFIED,           "Unspecified" },
+            { DMI_CHASSIS_TYPE_OTHER,                 "Other" },
+            { DMI_CHASSIS_TYPE_UNKNOWN,               "Unknown" },
+            { DMI_CHASSIS_TYPE_DESKTOP,               "Desktop" },
+            { DMI_CHASSIS_TYPE_LOW_PROFILE_DESKTOP,   "Low-profile desktop" },
+            { DMI_CHASSIS_TYPE_PIZZA_BOX,             "Pizza box" },
+            { DMI_CHASSIS_TYPE_MINI_TOWER,            "Mini tower" },
+            { DMI_CHASSIS_TYPE_TOWER,                 "Tower" },
+            { DMI_CHASSIS_TYPE_PORTABLE,              "Portable" },
+            { DMI_CHASSIS_TYPE_LAPTOP,                "Laptop" },
+            { DMI_CHASSIS_TYPE_NOTEBOOK,              "Notebook" },
+            { DMI_CHASSIS_TYPE_HANDHELD,              "Handheld" },
+            { DMI_CHASSIS_TYPE_DOCKING_STATION,       "Docking station" },
+            { DMI_CHASSIS_TYPE_ALL_IN_ONE,            "All-in-one" },
+            { DMI_CHASSIS_TYPE_SUB_NOTEBOOK,          "Sub-notebook" },
+            { DMI_CHASSIS_TYPE_SPACE_SAVING,          "Space-saving" },
+            { DMI_CHASSIS_TYPE_LUNCH_BOX,             "Lunch box" },
+            { DMI_CHASSIS_TYPE_MAIN_SERVER_CHASSIS,   "Main server chassis" },
+            { DMI_CHASSIS_TYPE_EXPANSION_CHASSIS,     "Expansion chassis" },
+            { DMI_CHASSIS_TYPE_SUB_CHASSIS,           "Sub-chassis" },
+            { DMI_CHASSIS_TYPE_BUS_EXPANSION_CHASSIS, "Bus expansion chassis" },
+            { DMI_CHASSIS_TYPE_PERIPHERAL_CHASSIS,    "Peripheral chassis" },
+            { DMI_CHASSIS_TYPE_RAID_CHASSIS,          "RAID chassis" },
+            { DMI_CHASSIS_TYPE_RACK_MOUNT_CHASSIS,    "Rack-mount chassis" },
+            { DMI_CHASSIS_TYPE_SEALED_CASE_PC,        "Sealed-case PC" },
+            { DMI_CHASSIS_TYPE_MULTI_SYSTEM_CHASSIS,  "Multi-system chassis" },
+            { DMI_CHASSIS_TYPE_COMPACT_PCI,           "Compact PCI" },
+            { DMI_CHASSIS_TYPE_ADVANCED_TCA,          "Advanced TCA" },
+            { DMI_CHASSIS_TYPE_BLADE,                 "Blade" },
+            { DMI_CHASSIS_TYPE_BLADE_ENCLOSURE,       "Blade chassis" },
+            { DMI_CHASSIS_TYPE_TABLET,                "Tablet" },
+            { DMI_CHASSIS_TYPE_CONVERTIBLE,           "Convertible" },
+            { DMI_CHASSIS_TYPE_DETACHABLE,            "Detachable" },
+            { DMI_CHASSIS_TYPE_IOT_GATEWAY,           "IoT gateway" },
+            { DMI_CHASSIS_TYPE_EMBEDDED_PC,           "Embedded PC" },
+            { DMI_CHASSIS_TYPE_MINI_PC,               "Mini PC" },
+            { DMI_CHASSIS_TYPE_STICK_PC,              "Stick PC" }
+        };
+
+        inline constexpr auto& chassis_type_names = dmi::detail::names<37, chassis_type_entries>;
+
+        inline constexpr dmi::detail::name_entry chassis_state_entries[] = {
+            { DMI_CHASSIS_STATE_UNSPECIFIED,     "Unspecified" },
+            { DMI_CHASSIS_STATE_OTHER,           "Other" },
+            { DMI_CHASSIS_STATE_UNKNOWN,         "Unknown" },
+            { DMI_CHASSIS_STATE_SAFE,            "Safe" },
+            { DMI_CHASSIS_STATE_WARNING,         "Warning" },
+            { DMI_CHASSIS_STATE_CRITICAL,        "Critical" },
+            { DMI_CHASSIS_STATE_NON_RECOVERABLE, "Non-recoverable" }
+        };
+
+        inline constexpr auto& chassis_state_names = dmi::detail::names<7, chassis_state_entries>;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(chassis_type value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::chassis_type_names, value);
+    }
+
     /**
      * @throws std::invalid_argument
      */
-    const std::string_view to_string(chassis_type value);
+    constexpr std::string_view to_string(chassis_type value)
+    {
+        return dmi::detail::to_name(detail::chassis_type_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(chassis_type) noexcept
+    {
+        return detail::chassis_type_names;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(chassis_state value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::chassis_state_names, value);
+    }
 
     /**
      * @throws std::invalid_argument
      */
-    const std::string_view to_string(chassis_state value);
+    constexpr std::string_view to_string(chassis_state value)
+    {
+        return dmi::detail::to_name(detail::chassis_state_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(chassis_state) noexcept
+    {
+        return detail::chassis_state_names;
+    }
 };
 
 #endif // __cplusplus
 
+// Structure layout and view, generated from schema/smbios.json.
+#include <dmi/table/generated/chassis.h>
+
 #endif // !DMI_TABLE_CHASSIS_H
@@ -8,6 +8,17 @@
 #pragma once
 
 #include <dmi/table.h>
+#include <dmi/enum.h>
+#include <dmi/decode.h>
+#include <dmi/field.h>
+#include <dmi/structure.h>
+#include <dmi/version.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
 
 /**
  * @brief Cooling device types.
@@ -62,6 +73,17 @@ struct dmi_cooling_device_table
      */
     dmi_header_t header;
 
+    /**
+     * @brief Temperature probe handle.
+     *
+     * @details
+     * Handle of the temperature probe monitoring this cooling device, or
+     * 0xFFFF if no probe is provided.
+     *
+     * @since SMBIOS 2.2
+     */
+    dmi_handle_t temperature_probe_handle;
+
     /**
      * @brief Cooling device type.
      *
@@ -125,6 +147,11 @@ struct dmi_cooling_device_table
     uint8_t description;
 } __attribute__((packed));
 
+static_assert(offsetof(dmi_cooling_device_table, cooling_unit_group) == 0x07);
+static_assert(offsetof(dmi_cooling_device_table, oem_specific) == 0x08);
+static_assert(offsetof(dmi_cooling_device_table, nominal_speed) == 0x0C);
+static_assert(offsetof(dmi_cooling_device_table, description) == 0x0E);
+
 __BEGIN_DECLS
 
 const char *dmi_cooling_device_type_str(dmi_cooling_device_type_t value);
@@ -132,4 +159,368 @@ const char *dmi_cooling_device_status_str(dmi_cooling_device_status_t value);
 
 __END_DECLS
 
+#ifdef __cplusplus
+
+namespace dmi::table
+{
+    /**
+     * @brief Cooling device types.
+     */
+    enum class cooling_device_type : uint8_t
+    {
+        unspecified              = DMI_COOLING_DEVICE_TYPE_UNSPECIFIED,              //< Unspecified
+        other                    = DMI_COOLING_DEVICE_TYPE_OTHER,                    //< Other
+        unknown                  = DMI_COOLING_DEVICE_TYPE_UNKNOWN,                  //< Unknown
+        fan                      = DMI_COOLING_DEVICE_TYPE_FAN,                      //< Fan
+        centrifugal_blower       = DMI_COOLING_DEVICE_TYPE_CENTRIFUGAL_BLOWER,       //< Centrifugal blower
+        chip_fan                 = DMI_COOLING_DEVICE_TYPE_CHIP_FAN,                 //< Chip fan
+        cabinet_fan              = DMI_COOLING_DEVICE_TYPE_CABINET_FAN,              //< Cabinet fan
+        power_supply_fan         = DMI_COOLING_DEVICE_TYPE_POWER_SUPPLY_FAN,         //< Power supply fan
+        heat_pipe                = DMI_COOLING_DEVICE_TYPE_HEAT_PIPE,                //< Heat pipe
+        integrated_refrigeration = DMI_COOLING_DEVICE_TYPE_INTEGRATED_REFRIGERATION, //< Integrated refrigeration
+        active_cooling           = DMI_COOLING_DEVICE_TYPE_ACTIVE_COOLING,           //< Active cooling
+        passive_cooling          = DMI_COOLING_DEVICE_TYPE_PASSIVE_COOLING           //< Passive cooling
+    };
+
+    /**
+     * @brief Cooling device statuses.
+     */
+    enum class cooling_device_status : uint8_t
+    {
+        unspecified     = DMI_COOLING_DEVICE_STATUS_UNSPECIFIED,    //< Unspecified
+        other           = DMI_COOLING_DEVICE_STATUS_OTHER,          //< Other
+        unknown         = DMI_COOLING_DEVICE_STATUS_UNKNOWN,        //< Unknown
+        ok              = DMI_COOLING_DEVICE_STATUS_OK,             //< OK
+        non_critical    = DMI_COOLING_DEVICE_STATUS_NON_CRITICAL,   //< Non-critical
+        critical        = DMI_COOLING_DEVICE_STATUS_CRITICAL,       //< Critical
+        non_recoverable = DMI_COOLING_DEVICE_STATUS_NON_RECOVERABLE //< Non-recoverable
+    };
+
+    namespace detail
+    {
+        inline constexpr dmi::detail::name_entry cooling_device_type_entries[] = {
+            { DMI_COOLING_DEVICE_TYPE_UNSPECIFIED,              "Unspecified" },
+            { DMI_COOLING_DEVICE_TYPE_OTHER,                    "Other" },
+            { DMI_COOLING_DEVICE_TYPE_UNKNOWN,                  "Unknown" },
+            { DMI_COOLING_DEVICE_TYPE_FAN,                      "Fan" },
+            { DMI_COOLING_DEVICE_TYPE_CENTRIFUGAL_BLOWER,       "Centrifugal blower" },
+            { DMI_COOLING_DEVICE_TYPE_CHIP_FAN,                 "Chip fan" },
+            { DMI_COOLING_DEVICE_TYPE_CABINET_FAN,              "Cabinet fan" },
+            { DMI_COOLING_DEVICE_TYPE_POWER_SUPPLY_FAN,         "Power supply fan" },
+            { DMI_COOLING_DEVICE_TYPE_HEAT_PIPE,                "Heat pipe" },
+            { DMI_COOLING_DEVICE_TYPE_INTEGRATED_REFRIGERATION, "Integrated refrigeration" },
+            { DMI_COOLING_DEVICE_TYPE_ACTIVE_COOLING,           "Active cooling" },
+            { DMI_COOLING_DEVICE_TYPE_PASSIVE_COOLING,          "Passive cooling" }
+        };
+
+        inline constexpr auto& cooling_device_type_names = dmi::detail::names<18, cooling_device_type_entries>;
+
+        inline constexpr dmi::detail::name_entry cooling_device_status_entries[] = {
+            { DMI_COOLING_DEVICE_STATUS_UNSPECIFIED,     "Unspecified" },
+            { DMI_COOLING_DEVICE_STATUS_OTHER,           "Other" },
+            { DMI_COOLING_DEVICE_STATUS_UNKNOWN,         "Unknown" },
+            { DMI_COOLING_DEVICE_STATUS_OK,              "OK" },
+            { DMI_COOLING_DEVICE_STATUS_NON_CRITICAL,    "Non-critical" },
+            { DMI_COOLING_DEVICE_STATUS_CRITICAL,        "Critical" },
+            { DMI_COOLING_DEVICE_STATUS_NON_RECOVERABLE, "Non-recoverable" }
+        };
+
+        inline constexpr auto& cooling_device_status_names = dmi::detail::names<7, cooling_device_status_entries>;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(cooling_device_type value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::cooling_device_type_names, value);
+    }
+
+    /**
+     * @throws std::invalid_argument
+     */
+    constexpr std::string_view to_string(cooling_device_type value)
+    {
+        return dmi::detail::to_name(detail::cooling_device_type_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(cooling_device_type) noexcept
+    {
+        return detail::cooling_device_type_names;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(cooling_device_status value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::cooling_device_status_names, value);
+    }
+
+    /**
+     * @throws std::invalid_argument
+     */
+    constexpr std::string_view to_string(cooling_device_status value)
+    {
+        return dmi::detail::to_name(detail::cooling_device_status_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(cooling_device_status) noexcept
+    {
+        return detail::cooling_device_status_names;
+    }
+
+    /**
+     * @brief Cooling device fields, for use with dmi::decode().
+     */
+    enum class cooling_device_field : uint8_t
+    {
+        type                     = 1 << 0,
+        status                   = 1 << 1,
+        cooling_unit_group       = 1 << 2,
+        oem_specific             = 1 << 3,
+        nominal_speed            = 1 << 4,
+        description              = 1 << 5,
+        temperature_probe_handle = 1 << 6,
+        all                      = 0x7F
+    };
+
+    DMI_FIELD_MASK(cooling_device_field)
+
+    template <typename String>
+    class basic_cooling_device;
+
+    using cooling_device = basic_cooling_device<std::string>;
+    using cooling_device_record = basic_cooling_device<dmi::string_ref>;
+
+    /**
+     * @brief Length of the cooling device structure guaranteed by SMBIOS @p version.
+     */
+    constexpr size_t cooling_device_length(const version_id& version) noexcept
+    {
+        if (version >= smbios_2_7)
+            return offsetof(dmi_cooling_device_table, description) + 1;
+        if (version >= smbios_2_2)
+            return offsetof(dmi_cooling_device_table, nominal_speed);
+
+        return sizeof(dmi_header_t);
+    }
+
+    /**
+     * @brief Cooling device view.
+     *
+     * @details
+     * Zero-copy view of a cooling device structure, tied to the lifetime of
+     * the context it was obtained from.
+     *
+     * Fields that SMBIOS @p Min guarantees are read without a length check,
+     * the structure must be at least @ref min_length bytes long.
+     */
+    template <version_id Min = smbios_any>
+    class basic_cooling_device_view
+    {
+    private:
+        dmi::structure m_structure;
+
+    public:
+        static constexpr version_id min_version = Min;
+        static constexpr size_t min_length = cooling_device_length(Min);
+
+        /**
+         * @brief Offsets of the string number fields.
+         */
+        static constexpr std::array<size_t, 1> string_fields = { offsetof(dmi_cooling_device_table, description) };
+
+        /**
+         * @param structure Cooling device structure.
+         */
+        constexpr explicit basic_cooling_device_view(const dmi::structure& structure)
+            : m_structure(structure)
+        {
+        }
+
+        constexpr handle_t handle() const { return m_structure.handle(); }
+        constexpr const dmi::structure& structure() const { return m_structure; }
+
+        constexpr std::optional<handle_t> temperature_probe_handle() const
+        {
+            if (!has(offsetof(dmi_cooling_device_table, temperature_probe_handle), sizeof(handle_t)))
+                return std::nullopt;
+
+            handle_t handle = DMI_FIELD(base(), dmi_cooling_device_table, temperature_probe_handle);
+            if (handle == 0xFFFF)
+                return std::nullopt;
+
+            return handle;
+        }
+
+        constexpr cooling_device_type type() const
+        {
+            return cooling_device_type(type_status() & 0x1F);
+        }
+
+        constexpr cooling_device_status status() const
+        {
+            return cooling_device_status(type_status() >> 5);
+        }
+
+        constexpr uint8_t cooling_unit_group() const
+        {
+            if (!has(offsetof(dmi_cooling_device_table, cooling_unit_group), 1))
+                return 0;
+
+            return DMI_FIELD(base(), dmi_cooling_device_table, cooling_unit_group);
+        }
+
+        constexpr uint32_t oem_specific() const
+        {
+            if (!has(offsetof(dmi_cooling_device_table, oem_specific), sizeof(uint32_t)))
+                return 0;
+
+            return DMI_FIELD(base(), dmi_cooling_device_table, oem_specific);
+        }
+
+        constexpr std::optional<uint16_t> nominal_speed() const
+        {
+            if (!has(offsetof(dmi_cooling_device_table, nominal_speed), sizeof(uint16_t)))
+                return std::nullopt;
+
+            return DMI_FIELD(base(), dmi_cooling_device_table, nominal_speed);
+        }
+
+        inline std::optional<std::string_view> description() const
+        {
+            if (!has(offsetof(dmi_cooling_device_table, description), 1))
+                return std::nullopt;
+
+            uint8_t index = DMI_FIELD(base(), dmi_cooling_device_table, description);
+            if (index == 0)
+                return std::nullopt;
+
+            return m_structure.string(index);
+        }
+
+        /**
+         * @brief Makes an owning copy of the structure.
+         */
+        cooling_device materialize() const;
+
+    private:
+        constexpr const std::byte *base() const
+        {
+            return m_structure.data().data();
+        }
+
+        /**
+         * @brief Device type (bits 4:0) and status (bits 7:5) byte.
+         */
+        constexpr uint8_t type_status() const
+        {
+            constexpr size_t offset = offsetof(dmi_cooling_device_table, temperature_probe_handle) +
+                sizeof(handle_t);
+
+            if (!has(offset, 1))
+                return 0;
+
+            return load<uint8_t>(base() + offset);
+        }
+
+        constexpr bool has(size_t offset, size_t size) const
+        {
+            return offset + size <= min_length || m_structure.covers(offset, size);
+        }
+    };
+
+    using cooling_device_view = basic_cooling_device_view<>;
+
+    template <typename String>
+    class basic_cooling_device : public dmi::basic_table
+    {
+    private:
+        cooling_device_type m_type;
+        cooling_device_status m_status;
+        uint8_t m_cooling_unit_group;
+        uint32_t m_oem_specific;
+        std::optional<uint16_t> m_nominal_speed;
+        std::optional<String> m_description;
+        std::optional<handle_t> m_temperature_probe_handle;
+        cooling_device_field m_fields;
+
+    public:
+        static constexpr dmi::table_type structure_type = table_type::cooling_device;
+
+        using view_type = cooling_device_view;
+        using field_type = cooling_device_field;
+
+        template <version_id Min>
+        using view_at = basic_cooling_device_view<Min>;
+
+        /**
+         * @brief Versions at which fields were added.
+         */
+        static constexpr std::array versions = { smbios_any, smbios_2_2, smbios_2_7 };
+
+        /**
+         * @brief Decodes the @p fields of @p view.
+         *
+         * @details
+         * Fields that are not selected are left empty (or zero). Strings
+         * are kept as @p strings returns them.
+         */
+        template <version_id Min, typename Strings = dmi::detail::copy_strings>
+        explicit basic_cooling_device(const basic_cooling_device_view<Min>& view,
+            cooling_device_field fields = cooling_device_field::all,
+            Strings&& strings = {})
+            : basic_table(view.handle()),
+              m_type{},
+              m_status{},
+              m_cooling_unit_group(0),
+              m_oem_specific(0),
+              m_fields(fields)
+        {
+            if (has_field(fields, cooling_device_field::type))
+                m_type = view.type();
+            if (has_field(fields, cooling_device_field::status))
+                m_status = view.status();
+            if (has_field(fields, cooling_device_field::cooling_unit_group))
+                m_cooling_unit_group = view.cooling_unit_group();
+            if (has_field(fields, cooling_device_field::oem_specific))
+                m_oem_specific = view.oem_specific();
+            if (has_field(fields, cooling_device_field::nominal_speed))
+                m_nominal_speed = view.nominal_speed();
+            if (has_field(fields, cooling_device_field::description))
+                m_description = strings(view.description());
+            if (has_field(fields, cooling_device_field::temperature_probe_handle))
+                m_temperature_probe_handle = view.temperature_probe_handle();
+        }
+
+        /**
+         * @brief Fields that were decoded.
+         */
+        inline cooling_device_field fields() const { return m_fields; }
+
+        inline cooling_device_type type() const { return m_type; }
+        inline cooling_device_status status() const { return m_status; }
+        inline uint8_t cooling_unit_group() const { return m_cooling_unit_group; }
+        inline uint32_t oem_specific() const { return m_oem_specific; }
+        inline const std::optional<uint16_t>& nominal_speed() const { return m_nominal_speed; }
+        inline const std::optional<String>& description() const { return m_description; }
+        inline const std::optional<handle_t>& temperature_probe_handle() const { return m_temperature_probe_handle; }
+    };
+
+    template <version_id Min>
+    inline cooling_device basic_cooling_device_view<Min>::materialize() const
+    {
+        return cooling_device(*this);
+    }
+};
+
+#endif // __cplusplus
+
 #endif // !DMI_TABLE_COOLING_DEVICE_H
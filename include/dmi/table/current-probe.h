@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Electrical current probe (type 29).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/current-probe.h>
+
 #endif // !DMI_TABLE_CURRENT_PROBE_H
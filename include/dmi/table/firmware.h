@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Firmware inventory information (type 45).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/firmware.h>
+
 #endif // !DMI_TABLE_FIRMWARE_H
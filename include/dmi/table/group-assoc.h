@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Group associations (type 14).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/group-assoc.h>
+
 #endif // !DMI_TABLE_GROUP_ASSOC_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Hardware security (type 24).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/hardware-security.h>
+
 #endif // !DMI_TABLE_HARDWARE_SECURITY_H
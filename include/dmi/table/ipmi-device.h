@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief IPMI device information (type 38).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/ipmi-device.h>
+
 #endif // !DMI_TABLE_IPMI_DEVICE_H
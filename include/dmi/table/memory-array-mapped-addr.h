@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Memory array mapped address (type 19).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-array-mapped-addr.h>
+
 #endif // !DMI_TABLE_MEMORY_ARRAY_MAPPED_ADDR_H
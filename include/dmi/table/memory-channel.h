@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Memory channel (type 37).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-channel.h>
+
 #endif // !DMI_TABLE_MEMORY_CHANNEL_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Memory controller information (type 5).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-controller.h>
+
 #endif // !DMI_TABLE_MEMORY_CONTROLLER_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Memory device mapped address (type 20).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-device-mapped-addr.h>
+
 #endif // !DMI_TABLE_MEMORY_DEVICE_MAPPED_ADDR_H
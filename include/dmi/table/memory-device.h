@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Memory device (type 17).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-device.h>
+
 #endif // !DMI_TABLE_MEMORY_DEVICE_H
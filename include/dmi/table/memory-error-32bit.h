@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief 32-bit memory error information (type 18).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-error-32bit.h>
+
 #endif // !DMI_TABLE_MEMORY_ERROR_32BIT_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief 64-bit memory error information (type 33).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-error-64bit.h>
+
 #endif // !DMI_TABLE_MEMORY_ERROR_64BIT_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Physical memory array (type 16).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/memory-phys-array.h>
+
 #endif // !DMI_TABLE_MEMORY_PHYS_ARRAY_H
@@ -0,0 +1,19 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_TABLE_MGMT_CONTROLLER_HOST_IF_H
+#define DMI_TABLE_MGMT_CONTROLLER_HOST_IF_H
+
+#pragma once
+
+/**
+ * @file
+ * @brief Management controller host interface (type 42).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/mgmt-controller-host-if.h>
+
+#endif // !DMI_TABLE_MGMT_CONTROLLER_HOST_IF_H
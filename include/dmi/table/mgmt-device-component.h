@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Management device component (type 35).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/mgmt-device-component.h>
+
 #endif // !DMI_TABLE_MGMT_DEVICE_COMPONENT_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Management device threshold data (type 36).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/mgmt-device-threshold.h>
+
 #endif // !DMI_TABLE_MGMT_DEVICE_THRESHOLD_H
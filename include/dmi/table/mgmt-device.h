@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Management device (type 34).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/mgmt-device.h>
+
 #endif // !DMI_TABLE_MGMT_DEVICE_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief OEM strings (type 11).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/oem-strings.h>
+
 #endif // !DMI_TABLE_OEM_STRINGS_H
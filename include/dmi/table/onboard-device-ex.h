@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Onboard devices extended information (type 41).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/onboard-device-ex.h>
+
 #endif // !DMI_TABLE_ONBOARD_DEVICE_EX_H
@@ -7,5 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief On board devices information (type 10).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/onboard-device.h>
 
 #endif // !DMI_TABLE_ONBOARD_DEVICE_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Out-of-band remote access (type 30).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/oob-remote-access.h>
+
 #endif // !DMI_TABLE_OOB_REMOTE_ACCESS_H
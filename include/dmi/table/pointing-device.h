@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Built-in pointing device (type 21).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/pointing-device.h>
+
 #endif // !DMI_TABLE_POINTING_DEVICE_H
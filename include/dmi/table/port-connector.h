@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Port connector information (type 8).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/port-connector.h>
+
 #endif // !DMI_TABLE_PORT_CONNECTOR_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Portable battery (type 22).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/portable-battery.h>
+
 #endif // !DMI_TABLE_PORTABLE_BATTERY_H
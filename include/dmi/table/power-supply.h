@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System power supply (type 39).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/power-supply.h>
+
 #endif // !DMI_TABLE_POWER_SUPPLY_H
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <dmi/table.h>
+#include <dmi/enum.h>
 
 /**
  * @brief Probe locations.
@@ -53,4 +54,132 @@ const char *dmi_probe_status_str(dmi_probe_status_t value);
 
 __END_DECLS
 
+#ifdef __cplusplus
+
+namespace dmi::table
+{
+    /**
+     * @brief Probe locations.
+     */
+    enum class probe_location : uint8_t
+    {
+        unspecified        = DMI_PROBE_LOCATION_UNSPECIFIED,        //< Unspecified
+        other              = DMI_PROBE_LOCATION_OTHER,              //< Other
+        unknown            = DMI_PROBE_LOCATION_UNKNOWN,            //< Unknown
+        processor          = DMI_PROBE_LOCATION_PROCESSOR,          //< Processor
+        disk               = DMI_PROBE_LOCATION_DISK,               //< Disk
+        peripheral_bay     = DMI_PROBE_LOCATION_PERIPHERAL_BAY,     //< Peripheral bay
+        system_mgmt_module = DMI_PROBE_LOCATION_SYSTEM_MGMT_MODULE, //< System management module
+        motherboard        = DMI_PROBE_LOCATION_MOTHERBOARD,        //< Motherboard
+        memory_module      = DMI_PROBE_LOCATION_MEMORY_MODULE,      //< Memory module
+        processor_module   = DMI_PROBE_LOCATION_PROCESSOR_MODULE,   //< Processor module
+        power_unit         = DMI_PROBE_LOCATION_POWER_UNIT,         //< Power unit
+        addin_card         = DMI_PROBE_LOCATION_ADDIN_CARD,         //< Add-in card
+        front_panel_board  = DMI_PROBE_LOCATION_FRONT_PANEL_BOARD,  //< Front panel board
+        back_panel_board   = DMI_PROBE_LOCATION_BACK_PANEL_BOARD,   //< Back panel location
+        power_system_board = DMI_PROBE_LOCATION_POWER_SYSTEM_BOARD, //< Power system board
+        drive_back_plane   = DMI_PROBE_LOCATION_DRIVE_BACK_PLANE    //< Drive back plane
+    };
+
+    /**
+     * @brief Probe statuses.
+     */
+    enum class probe_status : uint8_t
+    {
+        unspecified     = DMI_PROBE_STATUS_UNSPECIFIED,    //< Unspecified
+        other           = DMI_PROBE_STATUS_OTHER,          //< Other
+        unknown         = DMI_PROBE_STATUS_UNKNOWN,        //< Unknown
+        ok              = DMI_PROBE_STATUS_OK,             //< OK
+        non_critical    = DMI_PROBE_STATUS_NON_CRITICAL,   //< Non-critical
+        critical        = DMI_PROBE_STATUS_CRITICAL,       //< Critical
+        non_recoverable = DMI_PROBE_STATUS_NON_RECOVERABLE //< Non-recoverable
+    };
+
+    namespace detail
+    {
+        inline constexpr dmi::detail::name_entry probe_location_entries[] = {
+            { DMI_PROBE_LOCATION_UNSPECIFIED,        "Unspecified" },
+            { DMI_PROBE_LOCATION_OTHER,              "Other" },
+            { DMI_PROBE_LOCATION_UNKNOWN,            "Unknown" },
+            { DMI_PROBE_LOCATION_PROCESSOR,          "Processor" },
+            { DMI_PROBE_LOCATION_DISK,               "Disk" },
+            { DMI_PROBE_LOCATION_PERIPHERAL_BAY,     "Peripheral bay" },
+            { DMI_PROBE_LOCATION_SYSTEM_MGMT_MODULE, "System management module" },
+            { DMI_PROBE_LOCATION_MOTHERBOARD,        "Motherboard" },
+            { DMI_PROBE_LOCATION_MEMORY_MODULE,      "Memory module" },
+            { DMI_PROBE_LOCATION_PROCESSOR_MODULE,   "Processor module" },
+            { DMI_PROBE_LOCATION_POWER_UNIT,         "Power unit" },
+            { DMI_PROBE_LOCATION_ADDIN_CARD,         "Add-in card" },
+            { DMI_PROBE_LOCATION_FRONT_PANEL_BOARD,  "Front panel board" },
+            { DMI_PROBE_LOCATION_BACK_PANEL_BOARD,   "Back panel location" },
+            { DMI_PROBE_LOCATION_POWER_SYSTEM_BOARD, "Power system board" },
+            { DMI_PROBE_LOCATION_DRIVE_BACK_PLANE,   "Drive back plane" }
+        };
+
+        inline constexpr auto& probe_location_names = dmi::detail::names<16, probe_location_entries>;
+
+        inline constexpr dmi::detail::name_entry probe_status_entries[] = {
+            { DMI_PROBE_STATUS_UNSPECIFIED,     "Unspecified" },
+            { DMI_PROBE_STATUS_OTHER,           "Other" },
+            { DMI_PROBE_STATUS_UNKNOWN,         "Unknown" },
+            { DMI_PROBE_STATUS_OK,              "OK" },
+            { DMI_PROBE_STATUS_NON_CRITICAL,    "Non-critical" },
+            { DMI_PROBE_STATUS_CRITICAL,        "Critical" },
+            { DMI_PROBE_STATUS_NON_RECOVERABLE, "Non-recoverable" }
+        };
+
+        inline constexpr auto& probe_status_names = dmi::detail::names<7, probe_status_entries>;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(probe_location value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::probe_location_names, value);
+    }
+
+    /**
+     * @throws std::invalid_argument
+     */
+    constexpr std::string_view to_string(probe_location value)
+    {
+        return dmi::detail::to_name(detail::probe_location_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(probe_location) noexcept
+    {
+        return detail::probe_location_names;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(probe_status value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::probe_status_names, value);
+    }
+
+    /**
+     * @throws std::invalid_argument
+     */
+    constexpr std::string_view to_string(probe_status value)
+    {
+        return dmi::detail::to_name(detail::probe_status_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(probe_status) noexcept
+    {
+        return detail::probe_status_names;
+    }
+};
+
+#endif // __cplusplus
+
 #endif // !DMI_TABLE_PROBE_H
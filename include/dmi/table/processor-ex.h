@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Processor additional information (type 44).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/processor-ex.h>
+
 #endif // !DMI_TABLE_PROCESSOR_EX_H
@@ -0,0 +1,19 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_TABLE_STRING_PROPERTY_H
+#define DMI_TABLE_STRING_PROPERTY_H
+
+#pragma once
+
+/**
+ * @file
+ * @brief String property (type 46).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/string-property.h>
+
+#endif // !DMI_TABLE_STRING_PROPERTY_H
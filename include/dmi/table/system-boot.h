@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System boot information (type 32).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/system-boot.h>
+
 #endif // !DMI_TABLE_SYSTEM_BOOT_H
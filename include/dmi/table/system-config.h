@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System configuration options (type 12).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/system-config.h>
+
 #endif // !DMI_TABLE_SYSTEM_CONFIG_H
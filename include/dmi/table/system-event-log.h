@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System event log (type 15).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/system-event-log.h>
+
 #endif // !DMI_TABLE_SYSTEM_EVENT_LOG_H
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System power controls (type 25).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/system-power-controls.h>
+
 #endif // !DMI_TABLE_SYSTEM_POWER_CONTROLS_H
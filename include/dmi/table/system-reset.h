@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief System reset (type 23).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/system-reset.h>
+
 #endif // !DMI_TABLE_SYSTEM_RESET_H
@@ -7,20 +7,13 @@
 
 #pragma once
 
-#include <dmi/table.h>
-
 /**
- * @brief Slot heights.
+ * @file
+ * @brief System slots (type 9).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
  */
-enum dmi_system_slot_height : uint8_t
-{
-    DMI_SLOT_HEIGHT_NOT_APPLICABLE = 0x00, //< Not applicable
-    DMI_SLOT_HEIGHT_OTHER          = 0x01, //< Other
-    DMI_SLOT_HEIGHT_UNKNOWN        = 0x02, //< Unknown
-    DMI_SLOT_HEIGHT_FULL           = 0x03, //< Full height
-    DMI_SLOT_HEIGHT_LOW_PROFILE    = 0x04  //< Low-profile
-};
-
-typedef enum dmi_system_slot_height dmi_system_slot_height_t;
+#include <dmi/table/generated/system-slots.h>
 
 #endif // !DMI_TABLE_SYSTEM_SLOTS_H
@@ -8,8 +8,16 @@
 #pragma once
 
 #include <dmi/table.h>
+#include <dmi/enum.h>
+#include <dmi/decode.h>
+#include <dmi/field.h>
+#include <dmi/structure.h>
+#include <dmi/version.h>
 
+#include <array>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <optional>
 
 /**
@@ -151,6 +159,11 @@ struct dmi_system_table
     uint8_t family;
 } __attribute__((packed));
 
+static_assert(offsetof(dmi_system_table, serial_number) == 0x07);
+static_assert(offsetof(dmi_system_table, uuid) == 0x08);
+static_assert(offsetof(dmi_system_table, wakeup_type) == 0x18);
+static_assert(offsetof(dmi_system_table, family) == 0x1A);
+
 __BEGIN_DECLS
 
 const char *dmi_system_wakeup_str(dmi_system_wakeup_t value);
@@ -177,31 +190,304 @@ namespace dmi::table
         ac_power     = DMI_SYSTEM_WAKEUP_AC_POWER      //< AC power restored
     };
 
+    namespace detail
+    {
+        inline constexpr dmi::detail::name_entry system_wakeup_entries[] = {
+            { DMI_SYSTEM_WAKEUP_RESERVED,     "Reserved" },
+            { DMI_SYSTEM_WAKEUP_OTHER,        "Other" },
+            { DMI_SYSTEM_WAKEUP_UNKNOWN,      "Unknown" },
+            { DMI_SYSTEM_WAKEUP_APM_TIMER,    "APM timer" },
+            { DMI_SYSTEM_WAKEUP_MODEM_RING,   "Modem ring" },
+            { DMI_SYSTEM_WAKEUP_LAN_REMOTE,   "LAN remote" },
+            { DMI_SYSTEM_WAKEUP_POWER_SWITCH, "Power switch" },
+            { DMI_SYSTEM_WAKEUP_PCI_PME,      "PCI PME#" },
+            { DMI_SYSTEM_WAKEUP_AC_POWER,     "AC power restored" }
+        };
+
+        inline constexpr auto& system_wakeup_names = dmi::detail::names<9, system_wakeup_entries>;
+    }
+
+    /**
+     * @brief Non-throwing to_string().
+     */
+    constexpr auto try_to_string(system_wakeup value) noexcept -> result<std::string_view>
+    {
+        return dmi::detail::try_name(detail::system_wakeup_names, value);
+    }
+
     /**
      * @throws std::invalid_argument
      */
-    const std::string_view to_string(system_wakeup value);
+    constexpr std::string_view to_string(system_wakeup value)
+    {
+        return dmi::detail::to_name(detail::system_wakeup_names, value);
+    }
+
+    /**
+     * @brief Name table, for dmi::from_string().
+     */
+    constexpr const auto& names_of(system_wakeup) noexcept
+    {
+        return detail::system_wakeup_names;
+    }
+
+    /**
+     * @brief System UUID, in SMBIOS (wire format) byte order.
+     */
+    using system_uuid = std::array<uint8_t, 16>;
+
+    /**
+     * @brief System information fields, for use with dmi::decode().
+     */
+    enum class system_field : uint8_t
+    {
+        manufacturer  = 1 << 0,
+        product       = 1 << 1,
+        version       = 1 << 2,
+        serial_number = 1 << 3,
+        uuid          = 1 << 4,
+        wakeup_type   = 1 << 5,
+        sku_number    = 1 << 6,
+        family        = 1 << 7,
+        all           = 0xFF
+    };
+
+    DMI_FIELD_MASK(system_field)
+
+    template <typename String>
+    class basic_system;
+
+    using system = basic_system<std::string>;
+    using system_record = basic_system<dmi::string_ref>;
+
+    /**
+     * @brief Length of the system information structure guaranteed by
+     * SMBIOS @p version.
+     */
+    constexpr size_t system_length(const version_id& version) noexcept
+    {
+        if (version >= smbios_2_4)
+            return offsetof(dmi_system_table, family) + 1;
+        if (version >= smbios_2_1)
+            return offsetof(dmi_system_table, wakeup_type) + 1;
+        if (version >= smbios_2_0)
+            return offsetof(dmi_system_table, serial_number) + 1;
+
+        return sizeof(dmi_header_t);
+    }
 
-    class system : public dmi::basic_table
+    /**
+     * @brief System information view.
+     *
+     * @details
+     * Zero-copy view of a system information structure. Strings point into
+     * the buffer of the context the structure was obtained from, so a view
+     * must not outlive its context. Use materialize() for an owning copy.
+     *
+     * Fields that SMBIOS @p Min guarantees are read without a length check.
+     * The structure must be at least @ref min_length bytes long, which
+     * dmi::decode() checks when it picks a view for a table version.
+     */
+    template <version_id Min = smbios_any>
+    class basic_system_view
     {
     private:
-        std::string m_manufacturer;
-        std::optional<std::string> m_family;
-        std::string m_product;
-        std::string m_version;
-        std::optional<std::string> m_serial_number;
-        std::optional<std::string> m_sku_number;
+        dmi::structure m_structure;
+
+    public:
+        static constexpr version_id min_version = Min;
+        static constexpr size_t min_length = system_length(Min);
+
+        /**
+         * @brief Offsets of the string number fields.
+         */
+        static constexpr std::array<size_t, 6> string_fields = {
+            offsetof(dmi_system_table, manufacturer),
+            offsetof(dmi_system_table, product),
+            offsetof(dmi_system_table, version),
+            offsetof(dmi_system_table, serial_number),
+            offsetof(dmi_system_table, sku_number),
+            offsetof(dmi_system_table, family)
+        };
+
+        /**
+         * @param structure System information structure.
+         */
+        constexpr explicit basic_system_view(const dmi::structure& structure)
+            : m_structure(structure)
+        {
+        }
+
+        constexpr handle_t handle() const { return m_structure.handle(); }
+        constexpr const dmi::structure& structure() const { return m_structure; }
+
+        inline std::string_view manufacturer() const
+        {
+            return string(offsetof(dmi_system_table, manufacturer));
+        }
+
+        inline std::string_view product() const
+        {
+            return string(offsetof(dmi_system_table, product));
+        }
+
+        inline std::string_view version() const
+        {
+            return string(offsetof(dmi_system_table, version));
+        }
+
+        inline std::optional<std::string_view> serial_number() const
+        {
+            return optional_string(offsetof(dmi_system_table, serial_number));
+        }
+
+        constexpr std::optional<system_uuid> uuid() const
+        {
+            if (!has(offsetof(dmi_system_table, uuid), sizeof(system_uuid)))
+                return std::nullopt;
+
+            system_uuid result;
+            for (size_t i = 0; i < result.size(); i++)
+                result[i] = load<uint8_t>(base() + offsetof(dmi_system_table, uuid) + i);
+            return result;
+        }
+
+        constexpr std::optional<system_wakeup> wakeup_type() const
+        {
+            if (!has(offsetof(dmi_system_table, wakeup_type), 1))
+                return std::nullopt;
+
+            return system_wakeup(DMI_FIELD(base(), dmi_system_table, wakeup_type));
+        }
+
+        inline std::optional<std::string_view> sku_number() const
+        {
+            return optional_string(offsetof(dmi_system_table, sku_number));
+        }
+
+        inline std::optional<std::string_view> family() const
+        {
+            return optional_string(offsetof(dmi_system_table, family));
+        }
+
+        /**
+         * @brief Makes an owning copy of the structure.
+         */
+        system materialize() const;
+
+    private:
+        constexpr const std::byte *base() const
+        {
+            return m_structure.data().data();
+        }
+
+        constexpr bool has(size_t offset, size_t size) const
+        {
+            return offset + size <= min_length || m_structure.covers(offset, size);
+        }
+
+        inline std::string_view string(size_t offset) const
+        {
+            if (!has(offset, 1))
+                return {};
+
+            return m_structure.string(load<uint8_t>(base() + offset));
+        }
+
+        inline std::optional<std::string_view> optional_string(size_t offset) const
+        {
+            if (!has(offset, 1))
+                return std::nullopt;
+
+            uint8_t index = load<uint8_t>(base() + offset);
+            if (index == 0)
+                return std::nullopt;
+
+            return m_structure.string(index);
+        }
+    };
+
+    using system_view = basic_system_view<>;
+
+    template <typename String>
+    class basic_system : public dmi::basic_table
+    {
+    private:
+        String m_manufacturer;
+        std::optional<String> m_family;
+        String m_product;
+        String m_version;
+        std::optional<String> m_serial_number;
+        std::optional<String> m_sku_number;
+        std::optional<system_uuid> m_uuid;
         std::optional<system_wakeup> m_wakeup_type;
+        system_field m_fields;
 
     public:
-        inline const std::string& manufacturer() const { return m_manufacturer; }
-        inline const std::optional<std::string>& family() const { return m_family; }
-        inline const std::string& product() const { return m_product; }
-        inline const std::string& version() const { return m_version; }
-        inline const std::optional<std::string>& serial_number() const { return m_serial_number; }
-        inline const std::optional<std::string>& sku_number() const { return m_sku_number; }
+        static constexpr dmi::table_type structure_type = table_type::system;
+
+        using view_type = system_view;
+        using field_type = system_field;
+
+        template <version_id Min>
+        using view_at = basic_system_view<Min>;
+
+        /**
+         * @brief Versions at which fields were added.
+         */
+        static constexpr std::array versions = { smbios_any, smbios_2_0, smbios_2_1, smbios_2_4 };
+
+        /**
+         * @brief Decodes the @p fields of @p view.
+         *
+         * @details
+         * Fields that are not selected are left empty. Strings are kept
+         * as @p strings returns them.
+         */
+        template <version_id Min, typename Strings = dmi::detail::copy_strings>
+        explicit basic_system(const basic_system_view<Min>& view,
+            system_field fields = system_field::all, Strings&& strings = {})
+            : basic_table(view.handle()),
+              m_fields(fields)
+        {
+            if (has_field(fields, system_field::manufacturer))
+                m_manufacturer = strings(view.manufacturer());
+            if (has_field(fields, system_field::family))
+                m_family = strings(view.family());
+            if (has_field(fields, system_field::product))
+                m_product = strings(view.product());
+            if (has_field(fields, system_field::version))
+                m_version = strings(view.version());
+            if (has_field(fields, system_field::serial_number))
+                m_serial_number = strings(view.serial_number());
+            if (has_field(fields, system_field::sku_number))
+                m_sku_number = strings(view.sku_number());
+            if (has_field(fields, system_field::uuid))
+                m_uuid = view.uuid();
+            if (has_field(fields, system_field::wakeup_type))
+                m_wakeup_type = view.wakeup_type();
+        }
+
+        /**
+         * @brief Fields that were decoded.
+         */
+        inline system_field fields() const { return m_fields; }
+
+        inline const String& manufacturer() const { return m_manufacturer; }
+        inline const std::optional<String>& family() const { return m_family; }
+        inline const String& product() const { return m_product; }
+        inline const String& version() const { return m_version; }
+        inline const std::optional<String>& serial_number() const { return m_serial_number; }
+        inline const std::optional<String>& sku_number() const { return m_sku_number; }
+        inline const std::optional<system_uuid>& uuid() const { return m_uuid; }
         inline const std::optional<system_wakeup> wakeup_type() const { return m_wakeup_type; }
     };
+
+    template <version_id Min>
+    inline system basic_system_view<Min>::materialize() const
+    {
+        return system(*this);
+    }
 };
 
 #endif // __cplusplus
@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Temperature probe (type 28).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/temperature-probe.h>
+
 #endif // !DMI_TABLE_TEMPERATURE_PROBE_H
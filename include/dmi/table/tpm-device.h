@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief TPM device (type 43).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/tpm-device.h>
+
 #endif // !DMI_TABLE_TPM_DEVICE_H
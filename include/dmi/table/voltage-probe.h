@@ -7,4 +7,13 @@
 
 #pragma once
 
+/**
+ * @file
+ * @brief Voltage probe (type 26).
+ *
+ * @details
+ * Generated from schema/smbios.json at build time.
+ */
+#include <dmi/table/generated/voltage-probe.h>
+
 #endif // !DMI_TABLE_VOLTAGE_PROBE_H
@@ -0,0 +1,389 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_TRAITS_H
+#define DMI_TRAITS_H
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <dmi/table.h>
+#include <dmi/structure.h>
+#include <dmi/table/system.h>
+#include <dmi/table/cache.h>
+#include <dmi/table/cooling-device.h>
+#include <dmi/table/generated/tables.h>
+
+namespace dmi
+{
+    /**
+     * @brief Types associated with the structure type @p Type.
+     *
+     * @details
+     * Specialized for every structure type the library decodes, with:
+     *
+     * - `raw_type`, the packed C struct laying out the formatted area;
+     * - `view_type`, the zero-copy view reading it;
+     * - `decoded_type`, the owning class decoded from the view;
+     * - `record_type`, the same class keeping its strings as offsets, as
+     *   stored by the context;
+     * - `min_length`, the shortest formatted area the library accepts.
+     *
+     * Other types are left undefined, see registered_table.
+     */
+    template <table_type Type>
+    struct table_traits
+    {
+    };
+
+    template <>
+    struct table_traits<table_type::system>
+    {
+        using raw_type = dmi_system_table;
+        using view_type = table::system_view;
+        using decoded_type = table::system;
+        using record_type = table::system_record;
+
+        static constexpr size_t min_length = table::system_length(smbios_any);
+    };
+
+    template <>
+    struct table_traits<table_type::cache>
+    {
+        using raw_type = dmi_cache_table;
+        using view_type = table::cache_view;
+        using decoded_type = table::cache;
+        using record_type = table::cache_record;
+
+        static constexpr size_t min_length = table::cache_length(smbios_any);
+    };
+
+    template <>
+    struct table_traits<table_type::cooling_device>
+    {
+        using raw_type = dmi_cooling_device_table;
+        using view_type = table::cooling_device_view;
+        using decoded_type = table::cooling_device;
+        using record_type = table::cooling_device_record;
+
+        static constexpr size_t min_length = table::cooling_device_length(smbios_any);
+    };
+
+#define DMI_TABLE_TRAITS(name)                                                  \
+    template <>                                                                 \
+    struct table_traits<table_type::name>                                       \
+    {                                                                           \
+        using raw_type = dmi_##name##_table;                                    \
+        using view_type = table::name##_view;                                   \
+        using decoded_type = table::name;                                       \
+        using record_type = table::name##_record;                               \
+                                                                                \
+        static constexpr size_t min_length = table::name##_length(smbios_any);  \
+    };
+
+    // Types generated from the schema, see dmi/table/generated/tables.h.
+    DMI_GENERATED_TABLES(DMI_TABLE_TRAITS)
+
+#undef DMI_TABLE_TRAITS
+
+    /**
+     * @brief Structure type with a table_traits specialization.
+     */
+    template <table_type Type>
+    concept registered_table = requires {
+        typename table_traits<Type>::raw_type;
+        typename table_traits<Type>::view_type;
+        typename table_traits<Type>::decoded_type;
+        typename table_traits<Type>::record_type;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Whether the structure type @p type is compiled in.
+         */
+        constexpr bool is_enabled_table(table_type type) noexcept
+        {
+            for (table_type enabled : std::initializer_list<table_type>{ DMI_ENABLED_TABLE_TYPES })
+                if (enabled == type)
+                    return true;
+
+            return false;
+        }
+    }
+
+    /**
+     * @brief Structure type compiled in, all the registered ones unless
+     * restricted with the `DMI_TABLES` build option.
+     */
+    template <table_type Type>
+    concept enabled_table = registered_table<Type> && detail::is_enabled_table(Type);
+
+    /**
+     * @brief Decoded tables of one type stored by a context, with their
+     * strings.
+     *
+     * @details
+     * A contiguous range of trivially destructible records (e.g.
+     * dmi::table::system_record), whose strings are resolved with
+     * string(). Valid as long as the context.
+     */
+    template <typename Record>
+    class stored_tables
+    {
+    private:
+        std::span<const Record> m_records;
+        std::string_view m_strings;
+
+    public:
+        constexpr stored_tables() noexcept = default;
+
+        constexpr stored_tables(std::span<const Record> records, std::string_view strings) noexcept
+            : m_records(records),
+              m_strings(strings)
+        {
+        }
+
+        constexpr auto begin() const noexcept { return m_records.begin(); }
+        constexpr auto end() const noexcept { return m_records.end(); }
+        constexpr size_t size() const noexcept { return m_records.size(); }
+        constexpr bool empty() const noexcept { return m_records.empty(); }
+        constexpr const Record& operator[](size_t index) const { return m_records[index]; }
+
+        /**
+         * @brief Records, in table order.
+         */
+        constexpr std::span<const Record> records() const noexcept { return m_records; }
+
+        /**
+         * @brief Text of the string @p ref of a record.
+         */
+        constexpr std::string_view string(const string_ref& ref) const noexcept
+        {
+            return m_strings.substr(ref.offset, ref.size);
+        }
+
+        constexpr std::optional<std::string_view> string(const std::optional<string_ref>& ref) const noexcept
+        {
+            if (!ref)
+                return std::nullopt;
+
+            return string(*ref);
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Records of one type and the blob holding their strings.
+         */
+        template <typename Record>
+        struct table_block
+        {
+            using allocator_type = std::pmr::polymorphic_allocator<>;
+
+            std::pmr::vector<Record> records;
+            std::pmr::vector<char> strings;
+
+            table_block() = default;
+
+            explicit table_block(const allocator_type& allocator)
+                : records(allocator),
+                  strings(allocator)
+            {
+            }
+        };
+
+        /**
+         * @brief Appends the decoded strings to the blob @ref strings, and
+         * keeps their offsets.
+         */
+        struct blob_strings
+        {
+            std::pmr::vector<char>& strings;
+
+            inline string_ref operator()(std::string_view value) const
+            {
+                string_ref ref{ uint32_t(strings.size()), uint32_t(value.size()) };
+                strings.insert(strings.end(), value.begin(), value.end());
+                return ref;
+            }
+
+            inline std::optional<string_ref> operator()(std::optional<std::string_view> value) const
+            {
+                if (!value)
+                    return std::nullopt;
+
+                return (*this)(*value);
+            }
+        };
+
+        /**
+         * @brief Decoded tables of the structure types @p Types, in a
+         * contiguous vector of records per type.
+         *
+         * @details
+         * Each vector is filled once, on first access, and never changes
+         * afterwards. Records are trivially destructible: their strings are
+         * offsets into a blob per type, so that neither filling nor tearing
+         * down the store allocates or frees per string. Vectors are
+         * allocated from a memory resource that need not be thread-safe
+         * (e.g. a monotonic arena), fills are serialized.
+         */
+        template <table_type... Types>
+            requires (registered_table<Types> && ...)
+        class basic_table_store
+        {
+        private:
+            std::tuple<table_block<typename table_traits<Types>::record_type>...> m_tables;
+            std::array<std::once_flag, sizeof...(Types)> m_filled;
+            std::mutex m_lock;
+
+            static_assert((!std::is_polymorphic_v<typename table_traits<Types>::record_type> && ...),
+                "decoded tables must not have a vtable");
+            static_assert((std::is_trivially_destructible_v<typename table_traits<Types>::record_type> && ...),
+                "stored tables must not own memory");
+
+            template <table_type Type>
+            static consteval size_t index_of()
+            {
+                constexpr std::array types = { Types... };
+
+                for (size_t index = 0; index < types.size(); index++)
+                    if (types[index] == Type)
+                        return index;
+
+                return types.size();
+            }
+
+        public:
+            explicit basic_table_store(std::pmr::memory_resource *resource
+                = std::pmr::get_default_resource())
+                : m_tables(std::allocator_arg, std::pmr::polymorphic_allocator<>(resource))
+            {
+            }
+
+            /**
+             * @brief Decoded tables of @p Type, filled on first access by
+             * @p fill with the record vector and the blob_strings to decode
+             * them with.
+             */
+            template <table_type Type, typename Fill>
+            inline auto get(Fill&& fill) -> stored_tables<typename table_traits<Type>::record_type>
+            {
+                constexpr size_t index = index_of<Type>();
+                static_assert(index < sizeof...(Types));
+
+                auto& block = std::get<index>(m_tables);
+                std::call_once(m_filled[index], [&] {
+                    std::lock_guard lock(m_lock);
+                    fill(block.records, blob_strings{ block.strings });
+                });
+
+                return { block.records, { block.strings.data(), block.strings.size() } };
+            }
+        };
+
+        /**
+         * @brief Store of the tables compiled in.
+         *
+         * @details
+         * All the registered tables unless restricted with the `DMI_TABLES`
+         * build option, see dmi/table/generated/tables.h.
+         */
+        using table_store = basic_table_store<DMI_ENABLED_TABLE_TYPES>;
+    }
+
+    /**
+     * @brief Builds a visitor out of several callables.
+     *
+     * @code
+     * dmi::visit(structure, dmi::overloaded{
+     *     [](const dmi::table::system_view& system) { ... },
+     *     [](const dmi::table::cache_view& cache) { ... },
+     *     [](const dmi::structure& other) { ... },
+     * });
+     * @endcode
+     */
+    template <typename... Ts>
+    struct overloaded : Ts...
+    {
+        using Ts::operator()...;
+    };
+
+    namespace detail
+    {
+        template <typename F, typename R, uint8_t Type>
+        R visit_one(const structure& structure, F& visitor)
+        {
+            constexpr table_type type = table_type(Type);
+
+            if constexpr (registered_table<type>) {
+                using view = typename table_traits<type>::view_type;
+
+                // Views read the formatted area unchecked up to their
+                // minimum length, shorter structures stay untyped.
+                if constexpr (std::invocable<F&, const view&>) {
+                    if (structure.length() >= view::min_length)
+                        return std::invoke(visitor, view(structure));
+                }
+            }
+
+            return std::invoke(visitor, structure);
+        }
+
+        template <typename F, typename R, size_t... Types>
+        consteval auto make_visit_table(std::index_sequence<Types...>)
+        {
+            return std::array<R (*)(const structure&, F&), sizeof...(Types)>{
+                &visit_one<F, R, uint8_t(Types)>...
+            };
+        }
+
+        template <typename F, typename R>
+        inline constexpr auto visit_table =
+            make_visit_table<F, R>(std::make_index_sequence<256>());
+    }
+
+    /**
+     * @brief Calls @p visitor with the typed view of @p structure.
+     *
+     * @details
+     * Structures of a registered_table type are passed as their
+     * `table_traits<>::view_type` if the visitor accepts it. Other
+     * structures, and structures too short for their view, are passed as a
+     * plain dmi::structure, so the visitor must accept one. Every call must
+     * return the same type.
+     *
+     * Dispatch goes through a 256-entry table of functions indexed by the
+     * structure type, built at compile time for each visitor type: one
+     * indirect call per structure, whatever the number of cases.
+     */
+    template <typename F>
+        requires std::invocable<F&, const structure&>
+    inline decltype(auto) visit(const structure& structure, F&& visitor)
+    {
+        using result = std::invoke_result_t<F&, const dmi::structure&>;
+        using functor = std::remove_reference_t<F>;
+
+        return detail::visit_table<functor, result>[uint8_t(structure.type())](
+            structure, visitor);
+    }
+}
+
+#endif // !DMI_TRAITS_H
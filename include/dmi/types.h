@@ -64,6 +64,28 @@ struct dmi_header
 
 #ifdef __cplusplus
 
+#include <cstdlib>
+
+#include <dmi/config.h>
+
+/**
+ * @brief Throws @p exception.
+ *
+ * @details
+ * With the library built without exceptions (see the minimal profile and
+ * #DMI_NO_EXCEPTIONS), aborts instead: the throwing API stays available but
+ * fatal, and the `try_` functions report errors as values. Keyed on the
+ * library configuration rather than on the flags of each translation unit,
+ * so that inline functions have a single definition.
+ */
+#if DMI_NO_EXCEPTIONS
+#define DMI_THROW(exception) std::abort()
+#elif defined(__cpp_exceptions)
+#define DMI_THROW(exception) throw exception
+#else
+#error "libdmi-ng was built with exceptions: enable them, or configure it with ENABLE_MINIMAL"
+#endif
+
 namespace dmi
 {
     /**
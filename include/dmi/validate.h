@@ -0,0 +1,201 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_VALIDATE_H
+#define DMI_VALIDATE_H
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <dmi/types.h>
+#include <dmi/context.h>
+#include <dmi/decode.h>
+#include <dmi/directory.h>
+#include <dmi/structure.h>
+#include <dmi/version.h>
+
+namespace dmi
+{
+    /**
+     * @brief Table validation errors.
+     */
+    enum class validation_error : uint8_t
+    {
+        truncated,            //< Structure does not fit in the table
+        unterminated_strings, //< String set has no terminating double NUL within @ref DMI_STRINGS_SIZE_MAX bytes
+        string_index,         //< String number past the end of the string set
+        duplicate_handle,     //< Handle already used by another structure
+        short_structure,      //< Structure shorter than its SMBIOS version requires
+        version               //< Table older than the required SMBIOS version
+    };
+
+    /**
+     * @brief Problem found by validate().
+     */
+    struct validation_issue
+    {
+        /**
+         * @brief What is wrong.
+         */
+        validation_error error;
+
+        /**
+         * @brief Offset of the offending structure from the start of the
+         * table.
+         */
+        uint32_t offset;
+
+        /**
+         * @brief Handle of the offending structure, `0xFFFF` if unknown.
+         */
+        handle_t handle;
+    };
+
+    /**
+     * @brief Validates the table indexed by @p directory.
+     *
+     * @details
+     * Single pass over the directory checking that:
+     *
+     * - every structure up to the end-of-table structure (or the end of the
+     *   buffer) fits in the table and has a terminated string set;
+     * - string numbers of the structure types compiled in are in range;
+     * - handles are unique;
+     * - the table implements at least SMBIOS @p min and structures of the
+     *   types compiled in are as long as @p min requires.
+     *
+     * Issues are appended to @p issues if it is not null.
+     *
+     * @return `true` if no issue was found.
+     */
+    bool validate(const directory& directory, const version_id& version,
+        const version_id& min, std::vector<validation_issue> *issues = nullptr);
+
+    template <version_id Min>
+    class validated_table;
+
+    template <version_id Min>
+    auto validate(const directory& directory, const version_id& version,
+        std::vector<validation_issue> *issues = nullptr)
+        -> std::optional<validated_table<Min>>;
+
+    /**
+     * @brief Validated table.
+     *
+     * @details
+     * Token proving that a table passed validate() for SMBIOS @p Min. Its
+     * accessors do no bounds checking: structures of the known types are
+     * read through views gated on @p Min, whose fields need no length
+     * checks, and handles are known to be unique.
+     *
+     * Only the types compiled in have unchecked accessors, as validate()
+     * checks the lengths of no other type (see the `DMI_TABLES` build
+     * option).
+     *
+     * The token refers to the directory it was validated from, which must
+     * outlive it.
+     */
+    template <version_id Min = smbios_any>
+    class validated_table
+    {
+    private:
+        const directory *m_directory;
+        version_id m_version;
+
+        validated_table(const directory& directory, const version_id& version) noexcept
+            : m_directory(&directory),
+              m_version(version)
+        {
+        }
+
+        friend auto validate<Min>(const directory&, const version_id&,
+            std::vector<validation_issue> *) -> std::optional<validated_table<Min>>;
+
+    public:
+        static constexpr version_id min_version = Min;
+
+        /**
+         * @brief SMBIOS version implemented by the table.
+         */
+        inline const version_id& version() const { return m_version; }
+
+        inline const dmi::directory& index() const { return *m_directory; }
+        inline size_t size() const { return m_directory->size(); }
+        inline structure at(size_t index) const { return m_directory->at(index); }
+
+        inline auto find(table_type type) const
+        {
+            return m_directory->find(type);
+        }
+
+        inline std::optional<structure> find(handle_t handle) const
+        {
+            return m_directory->find(handle);
+        }
+
+        /**
+         * @brief Unchecked view of the structure at @p index, which must be
+         * of type `T::structure_type`.
+         */
+        template <version_gated T>
+            requires enabled_table<T::structure_type>
+        inline auto view(size_t index) const -> typename T::template view_at<Min>
+        {
+            return typename T::template view_at<Min>(at(index));
+        }
+
+        /**
+         * @brief Range of unchecked views of the structures of type
+         * `T::structure_type`.
+         */
+        template <version_gated T>
+            requires enabled_table<T::structure_type>
+        inline auto views() const
+        {
+            return m_directory->indices(uint8_t(T::structure_type)) | std::views::transform(
+                [this](uint32_t index) { return view<T>(index); });
+        }
+
+        /**
+         * @brief Decodes the @p fields of the structure at @p index.
+         */
+        template <version_gated T>
+            requires enabled_table<T::structure_type>
+        inline T decode(size_t index, typename T::field_type fields = T::field_type::all) const
+        {
+            return T(view<T>(index), fields);
+        }
+    };
+
+    /**
+     * @brief Validates the table indexed by @p directory for SMBIOS @p Min.
+     *
+     * @return A validated table token, or nothing if an issue was found.
+     */
+    template <version_id Min>
+    inline auto validate(const directory& directory, const version_id& version,
+        std::vector<validation_issue> *issues)
+        -> std::optional<validated_table<Min>>
+    {
+        if (!validate(directory, version, Min, issues))
+            return std::nullopt;
+
+        return validated_table<Min>(directory, version);
+    }
+
+    /**
+     * @brief Validates the table of @p context for SMBIOS @p Min.
+     */
+    template <version_id Min = smbios_any>
+    inline auto validate(const context& context,
+        std::vector<validation_issue> *issues = nullptr)
+        -> std::optional<validated_table<Min>>
+    {
+        return validate<Min>(context.index(), context.version(), issues);
+    }
+}
+
+#endif // !DMI_VALIDATE_H
@@ -52,9 +52,59 @@ struct dmi_version_id
 
 #ifdef __cplusplus
 
+#include <compare>
+
+constexpr bool operator==(const dmi_version_id& lhs, const dmi_version_id& rhs) noexcept
+{
+    return lhs.major == rhs.major && lhs.minor == rhs.minor && lhs.revision == rhs.revision;
+}
+
+constexpr std::strong_ordering operator<=>(const dmi_version_id& lhs, const dmi_version_id& rhs) noexcept
+{
+    if (auto order = lhs.major <=> rhs.major; order != 0)
+        return order;
+    if (auto order = lhs.minor <=> rhs.minor; order != 0)
+        return order;
+
+    return lhs.revision <=> rhs.revision;
+}
+
 namespace dmi
 {
     using version_id = ::dmi_version_id_t;
+
+    /**
+     * @brief No version guarantee.
+     *
+     * @details
+     * Decoders gated on this version check the length of every field.
+     */
+    inline constexpr version_id smbios_any{ 0, 0, 0 };
+
+    /**
+     * @brief SMBIOS versions that introduced structure fields.
+     *
+     * @details
+     * Usable as template arguments to gate decoders at compile time.
+     */
+    inline constexpr version_id smbios_2_0{ 2, 0, 0 };
+    inline constexpr version_id smbios_2_1{ 2, 1, 0 };
+    inline constexpr version_id smbios_2_2{ 2, 2, 0 };
+    inline constexpr version_id smbios_2_3{ 2, 3, 0 };
+    inline constexpr version_id smbios_2_4{ 2, 4, 0 };
+    inline constexpr version_id smbios_2_5{ 2, 5, 0 };
+    inline constexpr version_id smbios_2_6{ 2, 6, 0 };
+    inline constexpr version_id smbios_2_7{ 2, 7, 0 };
+    inline constexpr version_id smbios_2_8{ 2, 8, 0 };
+    inline constexpr version_id smbios_3_0{ 3, 0, 0 };
+    inline constexpr version_id smbios_3_1{ 3, 1, 0 };
+    inline constexpr version_id smbios_3_2{ 3, 2, 0 };
+    inline constexpr version_id smbios_3_3{ 3, 3, 0 };
+    inline constexpr version_id smbios_3_4{ 3, 4, 0 };
+    inline constexpr version_id smbios_3_5{ 3, 5, 0 };
+    inline constexpr version_id smbios_3_6{ 3, 6, 0 };
+    inline constexpr version_id smbios_3_7{ 3, 7, 0 };
+    inline constexpr version_id smbios_3_8{ 3, 8, 0 };
 }
 
 #endif // __cplusplus
@@ -3,3 +3,48 @@
 // SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
 //
 #include <dmi/context.h>
+#include <dmi/entry.h>
+
+#include <utility>
+
+using namespace dmi;
+
+context::context()
+    : context(DMI_SYSFS_ROOT)
+{
+}
+
+context::context(std::string_view root)
+    : context(source::open(root))
+{
+}
+
+context::context(std::span<const table_type> types, std::string_view root)
+    : context(source::open_entries(types, root))
+{
+}
+
+context::context(dmi::source&& source)
+    : m_source(std::move(source)),
+      m_directory(&m_arena),
+      m_version(smbios_any),
+      m_tables(&m_arena)
+{
+    auto eps = entry::parse(m_source.entry_point());
+    size_t count = eps ? eps->table_count().value_or(0) : 0;
+
+    if (eps)
+        m_version = eps->version();
+
+    // Same arena on both sides, so the arrays are moved, not copied.
+    m_directory = dmi::directory(m_source.table(), count, &m_arena);
+}
+
+context::~context()
+{
+}
+
+snapshot context::detach() const
+{
+    return snapshot(m_source.entry_point(), m_directory, m_version);
+}
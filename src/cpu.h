@@ -0,0 +1,86 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SRC_CPU_H
+#define DMI_SRC_CPU_H
+
+#pragma once
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DMI_HAVE_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define DMI_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace dmi::detail
+{
+    /**
+     * @brief SIMD instruction sets the library has kernels for.
+     */
+    enum class simd : unsigned char
+    {
+        scalar, //< Portable C++
+        sse2,   //< x86 SSE2
+        avx2,   //< x86 AVX2
+        neon    //< ARM Advanced SIMD
+    };
+
+#if defined(DMI_HAVE_X86)
+    /**
+     * @brief Checks for AVX2 and for the OS saving YMM registers.
+     *
+     * @details
+     * Queries CPUID directly: `__builtin_cpu_supports()` links in the
+     * libgcc CPU model, whose constructor would run at load time.
+     */
+    inline bool cpu_has_avx2() noexcept
+    {
+        unsigned eax, ebx, ecx, edx;
+
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_OSXSAVE) || !(ecx & bit_AVX))
+            return false;
+
+        unsigned xcr0_lo, xcr0_hi;
+        __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        if ((xcr0_lo & 0x6) != 0x6)
+            return false;
+
+        return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2);
+    }
+#endif
+
+    /**
+     * @brief Returns the widest instruction set supported by the running
+     * CPU.
+     *
+     * @details
+     * SSE2 and NEON are part of the x86-64 and AArch64 baselines and are
+     * selected at compile time; AVX2 is detected on first use.
+     */
+    inline simd cpu_simd() noexcept
+    {
+#if defined(DMI_HAVE_X86)
+        static const bool avx2 = cpu_has_avx2();
+        if (avx2)
+            return simd::avx2;
+#if defined(__SSE2__)
+        return simd::sse2;
+#else
+        unsigned eax, ebx, ecx, edx;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (edx & bit_SSE2))
+            return simd::sse2;
+        return simd::scalar;
+#endif
+#elif defined(DMI_HAVE_NEON)
+        return simd::neon;
+#else
+        return simd::scalar;
+#endif
+    }
+}
+
+#endif // !DMI_SRC_CPU_H
@@ -0,0 +1,127 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/directory.h>
+#include <dmi/strings.h>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+using namespace dmi;
+
+directory::directory(std::pmr::memory_resource *resource) noexcept
+    : m_records(resource),
+      m_strings(resource),
+      m_string_index(resource),
+      m_by_type(resource),
+      m_buckets{},
+      m_handles(resource),
+      m_handle_shift(32),
+      m_types{}
+{
+}
+
+directory::directory(std::span<const std::byte> table, size_t count,
+    std::pmr::memory_resource *resource)
+    : directory(resource)
+{
+    // Offsets are stored on 32 bits, which is also the largest table size
+    // an entry point can describe.
+    if (table.size() > std::numeric_limits<uint32_t>::max())
+        table = table.first(std::numeric_limits<uint32_t>::max());
+
+    m_table = table;
+    m_records.reserve(count + 1);
+    m_string_index.reserve(count + 1);
+    m_string_index.push_back(0);
+
+    const std::byte *begin = table.data();
+    const std::byte *end = begin + table.size();
+    const std::byte *ptr = begin;
+
+    for (;;) {
+        size_t avail = size_t(end - ptr);
+        if (avail < sizeof(dmi_header_t) + 2)
+            break;
+
+        uint8_t type = DMI_FIELD(ptr, dmi_header_t, type);
+        uint8_t length = DMI_FIELD(ptr, dmi_header_t, length);
+        if (length < sizeof(dmi_header_t) || length + 2u > avail)
+            break;
+        if (type == DMI_TABLE_END_OF_TABLE)
+            break;
+
+        // Measure the structure and index its strings in the same pass.
+        uint16_t offsets[DMI_STRINGS_MAX];
+        auto set = scan_strings({ ptr + length, end }, offsets);
+        if (set.size == 0)
+            break;
+
+        m_records.push_back({
+            uint32_t(ptr - begin), type, length, DMI_FIELD(ptr, dmi_header_t, handle)
+        });
+
+        m_strings.insert(m_strings.end(), offsets,
+            offsets + std::min<size_t>(set.count, DMI_STRINGS_MAX));
+        m_string_index.push_back(uint32_t(m_strings.size()));
+
+        ptr += length + set.size;
+    }
+
+    // Sentinel record marking the end of the last structure.
+    m_records.push_back({ uint32_t(ptr - begin), DMI_TABLE_END_OF_TABLE, 0, 0xFFFF });
+
+    index_types();
+    index_handles();
+}
+
+void directory::index_types()
+{
+    auto records = this->records();
+
+    // Counting sort by type, stable so that buckets are in table order.
+    std::array<uint32_t, 256> counts{};
+    for (const auto& record : records) {
+        counts[record.type]++;
+        m_types[record.type >> 6] |= uint64_t(1) << (record.type & 63);
+    }
+
+    m_buckets[0] = 0;
+    for (size_t type = 0; type < counts.size(); type++)
+        m_buckets[type + 1] = m_buckets[type] + counts[type];
+
+    std::array<uint32_t, 256> next;
+    std::copy_n(m_buckets.begin(), next.size(), next.begin());
+
+    m_by_type.resize(records.size());
+    for (uint32_t index = 0; index < records.size(); index++)
+        m_by_type[next[records[index].type]++] = index;
+}
+
+void directory::index_handles()
+{
+    auto records = this->records();
+
+    // At most half full, so that probe sequences stay short.
+    size_t capacity = std::bit_ceil(std::max<size_t>(records.size() * 2, detail::handle_slots_min));
+    m_handle_shift = 32 - unsigned(std::countr_zero(capacity));
+    m_handles.assign(capacity, 0);
+
+    size_t mask = capacity - 1;
+
+    for (uint32_t index = 0; index < records.size(); index++) {
+        handle_t handle = records[index].handle;
+
+        for (size_t slot = detail::handle_hash(handle, m_handle_shift);; slot = (slot + 1) & mask) {
+            uint32_t entry = m_handles[slot];
+            if (entry == 0) {
+                m_handles[slot] = index + 1;
+                break;
+            }
+            if (records[entry - 1].handle == handle)
+                break;
+        }
+    }
+}
@@ -2,9 +2,128 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
 //
+#include <cerrno>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <string_view>
 
-int main(void)
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <dmi/context.h>
+#include <dmi/stream.h>
+
+namespace
 {
-    return EXIT_SUCCESS;
+    /**
+     * @brief Prints @p structure like `dmidecode -u`: formatted area in hex,
+     * then the strings.
+     */
+    void print(const dmi::structure& structure)
+    {
+        std::printf("Handle 0x%04X, DMI type %u, %u bytes\n",
+            unsigned(structure.handle()), unsigned(structure.type()),
+            unsigned(structure.length()));
+
+        std::printf("\tHeader and Data:");
+        auto formatted = structure.formatted();
+        for (size_t i = 0; i < formatted.size(); i++)
+            std::printf("%s%02X", i % 16 == 0 ? "\n\t\t" : " ", unsigned(formatted[i]));
+        std::printf("\n");
+
+        auto strings = structure.strings();
+        if (strings.size() > 2) {
+            std::printf("\tStrings:\n");
+            for (size_t i = 0; i + 1 < strings.size() && strings[i] != std::byte(0);) {
+                auto string = reinterpret_cast<const char *>(strings.data() + i);
+                std::printf("\t\t%s\n", string);
+                i += std::strlen(string) + 1;
+            }
+        }
+
+        std::printf("\n");
+    }
+
+    void error(const char *what, const dmi::error& error)
+    {
+        auto message = dmi::to_string(error.code);
+
+        if (error.code == dmi::errc::io)
+            std::fprintf(stderr, "dmi-dump: %s: %s\n", what, std::strerror(int(error.offset)));
+        else
+            std::fprintf(stderr, "dmi-dump: %s: %.*s at offset %u\n", what,
+                int(message.size()), message.data(), unsigned(error.offset));
+    }
+
+    /**
+     * @brief Dumps the structure table read from standard input, as it
+     * arrives.
+     */
+    int dump_stream()
+    {
+        dmi::stream_parser parser;
+        std::byte buffer[4096];
+
+        for (;;) {
+            ssize_t count = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (count < 0) {
+                if (errno == EINTR)
+                    continue;
+                error("stdin", { dmi::errc::io, 0xFFFF, uint32_t(errno) });
+                return EXIT_FAILURE;
+            }
+            if (count == 0)
+                break;
+
+            auto result = parser.try_push({ buffer, size_t(count) }, print);
+            if (!result) {
+                error("stdin", result.error());
+                return EXIT_FAILURE;
+            }
+        }
+
+        if (auto result = parser.try_finish(); !result) {
+            error("stdin", result.error());
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    /**
+     * @brief Dumps the structure table exported via sysfs under @p path,
+     * or held by the raw dump file @p path, whatever its format.
+     */
+    int dump_path(const char *path)
+    {
+        struct stat st;
+        bool directory = ::stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+
+        auto source = directory ?
+            dmi::source::try_open(path) : dmi::source::try_load_file(path);
+        if (!source) {
+            error(path, source.error());
+            return EXIT_FAILURE;
+        }
+
+        dmi::context context(std::move(*source));
+        for (auto structure : context.structures())
+            print(structure);
+
+        return EXIT_SUCCESS;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2) {
+        std::fprintf(stderr, "usage: dmi-dump [<sysfs root> | <dump file> | -]\n");
+        return EXIT_FAILURE;
+    }
+
+    if (argc == 2 && std::string_view(argv[1]) == "-")
+        return dump_stream();
+
+    return dump_path(argc == 2 ? argv[1] : DMI_SYSFS_ROOT);
 }
@@ -0,0 +1,50 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SRC_ENTRY_POINT_H
+#define DMI_SRC_ENTRY_POINT_H
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <dmi/entry.h>
+
+namespace dmi::detail
+{
+    /**
+     * @brief Builds an SMBIOS 3.0 entry point for a table of @p size bytes
+     * implementing SMBIOS @p major.@p minor.@p revision.
+     *
+     * @details
+     * For tables that come without theirs, e.g. in Windows `RawSMBIOSData`
+     * blobs or rebuilt from dmidecode text.
+     */
+    inline auto make_entry_point(uint8_t major, uint8_t minor, uint8_t revision,
+        uint32_t size) noexcept -> std::array<std::byte, sizeof(dmi_entry_v30_t)>
+    {
+        std::array<std::byte, sizeof(dmi_entry_v30_t)> result{};
+        std::byte *ptr = result.data();
+
+        std::memcpy(ptr, DMI_ANCHOR_V30, 5);
+        ptr[offsetof(dmi_entry_v30_t, length)] = std::byte(sizeof(dmi_entry_v30_t));
+        ptr[offsetof(dmi_entry_v30_t, version_major)] = std::byte(major);
+        ptr[offsetof(dmi_entry_v30_t, version_minor)] = std::byte(minor);
+        ptr[offsetof(dmi_entry_v30_t, version_rev)] = std::byte(revision);
+        ptr[offsetof(dmi_entry_v30_t, revision)] = std::byte(1);
+        std::memcpy(ptr + offsetof(dmi_entry_v30_t, table_area_size_max), &size, sizeof(size));
+
+        uint8_t sum = 0;
+        for (std::byte byte : result)
+            sum = uint8_t(sum + uint8_t(byte));
+        ptr[offsetof(dmi_entry_v30_t, checksum)] = std::byte(uint8_t(-sum));
+
+        return result;
+    }
+}
+
+#endif // !DMI_SRC_ENTRY_POINT_H
@@ -3,93 +3,158 @@
 // SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
 //
 #include <dmi/entry.h>
+#include <dmi/field.h>
 
+#include <algorithm>
 #include <stdexcept>
-#include <memory>
-#include <fstream>
+#include <cstddef>
 #include <cstring>
 
 using namespace dmi;
 
-static const std::map<std::string, entry::factory> anchor_map =
+namespace
 {
+    /**
+     * @brief Checks an anchor string, @p N includes the terminating NUL.
+     */
+    template <size_t N>
+    inline bool has_anchor(const std::byte *ptr, size_t length,
+        const char (&anchor)[N]) noexcept
     {
-        DMI_ANCHOR_LEGACY,
-        [](const std::byte *ptr, size_t length) -> std::unique_ptr<entry>
-        {
-            return std::make_unique<entry_legacy>(ptr, length);
-        }
-    },
+        return length >= N - 1 && std::memcmp(ptr, anchor, N - 1) == 0;
+    }
+
+    inline bool checksum_ok(const std::byte *ptr, size_t length) noexcept
     {
-        DMI_ANCHOR_V21,
-        [](const std::byte *ptr, size_t length) -> std::unique_ptr<entry>
-        {
-            return std::make_unique<entry_v21>(ptr, length);
-        }
-    },
+        uint8_t sum = 0;
+
+        for (size_t i = 0; i < length; i++)
+            sum += uint8_t(ptr[i]);
+
+        return sum == 0;
+    }
+
+    inline std::unexpected<error> fail(errc code, size_t offset) noexcept
     {
-        DMI_ANCHOR_V30,
-        [](const std::byte *ptr, size_t length) -> std::unique_ptr<entry>
-        {
-            return std::make_unique<entry_v30>(ptr, length);
-        }
+        return std::unexpected(error{ code, 0xFFFF, uint32_t(offset) });
     }
-};
+}
 
-auto entry::create(const std::byte *ptr, size_t length)
-    -> std::unique_ptr<entry>
+auto entry::try_create(const std::byte *ptr, size_t length) noexcept
+    -> result<entry>
 {
-    if (ptr == nullptr)
-        throw std::invalid_argument("ptr");
-    if (length == 0)
-        throw std::invalid_argument("length");
+    if (ptr == nullptr || length == 0)
+        return fail(errc::invalid_argument, 0);
+
+    entry result;
 
-    entry::factory factory = nullptr;
+    if (has_anchor(ptr, length, DMI_ANCHOR_V30)) {
+        if (length < sizeof(dmi_entry_v30_t))
+            return fail(errc::truncated, length);
 
-    for (auto [anchor, item] : anchor_map) {
-        if (length < anchor.size())
-            continue;
-        if (std::memcmp(ptr, anchor.c_str(), anchor.size()) != 0)
-            continue;
+        uint8_t eps_length = DMI_FIELD(ptr, dmi_entry_v30_t, length);
+        if (eps_length < sizeof(dmi_entry_v30_t) || eps_length > length)
+            return fail(errc::bad_length, offsetof(dmi_entry_v30_t, length));
+        if (!checksum_ok(ptr, eps_length))
+            return fail(errc::bad_checksum, offsetof(dmi_entry_v30_t, checksum));
 
-        factory = item;
-        break;
+        result.m_type = entry_type::v30;
+        result.m_length = eps_length;
+        result.m_table_count = 0;
+        result.m_table_size_max = 0;
+        result.m_table_size = DMI_FIELD(ptr, dmi_entry_v30_t, table_area_size_max);
+        result.m_table_addr = DMI_FIELD(ptr, dmi_entry_v30_t, table_area_addr);
+        result.m_version = {
+            DMI_FIELD(ptr, dmi_entry_v30_t, version_major),
+            DMI_FIELD(ptr, dmi_entry_v30_t, version_minor),
+            DMI_FIELD(ptr, dmi_entry_v30_t, version_rev)
+        };
+
+        return result;
     }
 
-    if (factory == nullptr)
-        throw std::runtime_error("unsupported entry type");
+    if (has_anchor(ptr, length, DMI_ANCHOR_V21)) {
+        if (length <= offsetof(dmi_entry_v21_t, length))
+            return fail(errc::truncated, length);
 
-    return factory(ptr, length);
-}
+        // SMBIOS 2.1 specification mistakenly stated 0x1E as the length,
+        // so the buffer is only required to hold the declared length.
+        uint8_t eps_length = DMI_FIELD(ptr, dmi_entry_v21_t, length);
+        if (eps_length < sizeof(dmi_entry_v21_t) - 1 || eps_length > 0x20 ||
+            eps_length > length)
+            return fail(errc::bad_length, offsetof(dmi_entry_v21_t, length));
+        if (!checksum_ok(ptr, eps_length))
+            return fail(errc::bad_checksum, offsetof(dmi_entry_v21_t, checksum));
 
-entry::entry(const std::string& anchor, const std::byte *data, size_t length)
-{
-    if (anchor.empty())
-        throw std::invalid_argument("anchor");
-    if (data == nullptr)
-        throw std::invalid_argument("data");
-    if (length < anchor.size())
-        throw std::invalid_argument("length");
-
-    if (std::memcmp(data, anchor.c_str(), anchor.size()) != 0)
-        throw std::runtime_error("invalid entry point structure");
-}
+        // A 0x1E-byte entry point cuts the IEPS short of its BCD revision,
+        // which is not used: the rest is covered by the EPS checksum.
+        auto ieps = ptr + offsetof(dmi_entry_v21_t, ieps);
+        size_t ieps_length = std::min<size_t>(length - offsetof(dmi_entry_v21_t, ieps),
+            sizeof(dmi_entry_legacy_t));
+        if (!has_anchor(ieps, ieps_length, DMI_ANCHOR_LEGACY))
+            return fail(errc::no_anchor, offsetof(dmi_entry_v21_t, ieps));
+        if (ieps_length == sizeof(dmi_entry_legacy_t) &&
+            !checksum_ok(ieps, sizeof(dmi_entry_legacy_t)))
+            return fail(errc::bad_checksum, offsetof(dmi_entry_v21_t, ieps) +
+                offsetof(dmi_entry_legacy_t, checksum));
 
-entry::~entry()
-{
-}
+        result.m_type = entry_type::v21;
+        result.m_length = eps_length;
+        result.m_table_count = DMI_FIELD(ieps, dmi_entry_legacy_t, table_count);
+        result.m_table_size_max = DMI_FIELD(ptr, dmi_entry_v21_t, table_size_max);
+        result.m_table_size = DMI_FIELD(ieps, dmi_entry_legacy_t, table_area_size);
+        result.m_table_addr = DMI_FIELD(ieps, dmi_entry_legacy_t, table_area_addr);
+        result.m_version = {
+            DMI_FIELD(ptr, dmi_entry_v21_t, version_major),
+            DMI_FIELD(ptr, dmi_entry_v21_t, version_minor),
+            0
+        };
 
-entry_legacy::entry_legacy(const std::byte *data, size_t length)
-    : entry(DMI_ANCHOR_LEGACY, data, length)
-{
+        return result;
+    }
+
+    if (has_anchor(ptr, length, DMI_ANCHOR_LEGACY)) {
+        if (length < sizeof(dmi_entry_legacy_t))
+            return fail(errc::truncated, length);
+        if (!checksum_ok(ptr, sizeof(dmi_entry_legacy_t)))
+            return fail(errc::bad_checksum, offsetof(dmi_entry_legacy_t, checksum));
+
+        uint8_t version = DMI_FIELD(ptr, dmi_entry_legacy_t, version);
+
+        result.m_type = entry_type::legacy;
+        result.m_length = sizeof(dmi_entry_legacy_t);
+        result.m_table_count = DMI_FIELD(ptr, dmi_entry_legacy_t, table_count);
+        result.m_table_size_max = 0;
+        result.m_table_size = DMI_FIELD(ptr, dmi_entry_legacy_t, table_area_size);
+        result.m_table_addr = DMI_FIELD(ptr, dmi_entry_legacy_t, table_area_addr);
+        result.m_version = { bits<4, 4>(version), bits<0, 4>(version), 0 };
+
+        return result;
+    }
+
+    return fail(errc::no_anchor, 0);
 }
 
-entry_v21::entry_v21(const std::byte *data, size_t length)
-    : entry(DMI_ANCHOR_V21, data, length)
+auto entry::parse(const std::byte *ptr, size_t length) noexcept
+    -> std::optional<entry>
 {
+    auto result = try_create(ptr, length);
+    if (!result)
+        return std::nullopt;
+
+    return *result;
 }
 
-entry_v30::entry_v30(const std::byte *data, size_t length)
-    : entry(DMI_ANCHOR_V30, data, length)
+auto entry::create(const std::byte *ptr, size_t length) -> entry
 {
+    auto result = try_create(ptr, length);
+    if (result)
+        return *result;
+
+    if (ptr == nullptr)
+        DMI_THROW(std::invalid_argument("ptr"));
+    if (length == 0)
+        DMI_THROW(std::invalid_argument("length"));
+
+    DMI_THROW(std::runtime_error("invalid entry point structure"));
 }
@@ -0,0 +1,42 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#ifndef DMI_SRC_FILE_H
+#define DMI_SRC_FILE_H
+
+#pragma once
+
+#include <cstddef>
+
+#include <dmi/error.h>
+
+namespace dmi::detail
+{
+    /**
+     * @brief Contents of a file, mapped or read into the heap.
+     */
+    struct file_data
+    {
+        void *base;
+        size_t size;
+        bool mapped; //< Release with munmap(2) rather than free(3)
+    };
+
+    /**
+     * @brief Maps the file @p path or, when it cannot be mapped (e.g. a
+     * pipe or a sysfs file), reads it whole.
+     *
+     * @details
+     * System call failures are reported as @ref errc::io, with `errno` in
+     * error::offset.
+     */
+    auto read_file(const char *path) noexcept -> result<file_data>;
+
+    /**
+     * @brief Releases the contents read by read_file().
+     */
+    void release_file(const file_data& file) noexcept;
+}
+
+#endif // !DMI_SRC_FILE_H
@@ -0,0 +1,304 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/format.h>
+#include <dmi/entry.h>
+#include <dmi/source.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "entry-point.h"
+#include "file.h"
+
+using namespace dmi;
+
+namespace
+{
+    /**
+     * @brief Size of a tar header and of the blocks member data is padded to.
+     */
+    constexpr size_t tar_block = 512;
+
+    /**
+     * @brief Offset of the `ustar` magic in a tar header.
+     */
+    constexpr size_t tar_magic = 257;
+
+    inline bool starts_with(std::span<const std::byte> data, std::string_view prefix) noexcept
+    {
+        return data.size() >= prefix.size() &&
+            std::memcmp(data.data(), prefix.data(), prefix.size()) == 0;
+    }
+
+    inline uint32_t load32(const std::byte *ptr) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Text of the NUL-padded field of @p size bytes at @p ptr.
+     */
+    inline std::string_view field(const std::byte *ptr, size_t size) noexcept
+    {
+        auto text = reinterpret_cast<const char *>(ptr);
+        return { text, ::strnlen(text, size) };
+    }
+
+    /**
+     * @brief Entry point and table members of a tar archive.
+     *
+     * @details
+     * Walks the member headers, skipping their data, and picks the regular
+     * files named like the sysfs or QEMU `fw_cfg` files, whatever their
+     * directory.
+     */
+    auto tar_members(std::span<const std::byte> data) noexcept
+        -> std::pair<std::span<const std::byte>, std::span<const std::byte>>
+    {
+        std::span<const std::byte> entry_point;
+        std::span<const std::byte> table;
+
+        for (size_t offset = 0; data.size() - offset >= tar_block;) {
+            const std::byte *header = data.data() + offset;
+
+            auto name = field(header, 100);
+            if (name.empty())
+                break;
+
+            // Size in octal, NUL or space terminated.
+            uint64_t size = 0;
+            for (char digit : field(header + 124, 12)) {
+                if (digit < '0' || digit > '7')
+                    break;
+                size = size * 8 + uint64_t(digit - '0');
+            }
+
+            offset += tar_block;
+            size = std::min<uint64_t>(size, data.size() - offset);
+
+            char type = char(header[156]);
+            if (type == '0' || type == '\0') {
+                name = name.substr(name.rfind('/') + 1);
+                auto member = data.subspan(offset, size_t(size));
+
+                if (name == "smbios_entry_point" || name == "smbios-anchor")
+                    entry_point = member;
+                else if (name == "DMI" || name == "smbios-tables")
+                    table = member;
+            }
+
+            offset += std::min<uint64_t>((size + tar_block - 1) / tar_block * tar_block,
+                data.size() - offset);
+        }
+
+        return { entry_point, table };
+    }
+}
+
+dump_format dmi::detect_format(std::span<const std::byte> data) noexcept
+{
+    if (starts_with(data, DMI_ANCHOR_V30) || starts_with(data, DMI_ANCHOR_V21) ||
+        starts_with(data, DMI_ANCHOR_LEGACY))
+        return dump_format::dump_bin;
+
+    if (data.size() >= tar_block &&
+        starts_with(data.subspan(tar_magic), "ustar"))
+        return dump_format::tar;
+
+    // A structure length is at least 4, a major version at most 3: the
+    // second byte tells a Windows header from a structure header.
+    if (data.size() >= DMI_DUMP_WINDOWS_HEADER_SIZE &&
+        uint8_t(data[0]) <= 1 && (uint8_t(data[1]) == 2 || uint8_t(data[1]) == 3) &&
+        load32(data.data() + 4) <= data.size() - DMI_DUMP_WINDOWS_HEADER_SIZE)
+        return dump_format::windows;
+
+    if (data.size() >= sizeof(dmi_header_t) + 2 &&
+        uint8_t(data[1]) >= sizeof(dmi_header_t) && uint8_t(data[1]) + 2u <= data.size())
+        return dump_format::table;
+
+    return dump_format::unknown;
+}
+
+auto source::try_load(std::span<const std::byte> data) noexcept -> result<source>
+{
+    switch (detect_format(data)) {
+    case dump_format::dump_bin: {
+        auto eps = entry::try_create(data);
+        if (!eps)
+            return std::unexpected(eps.error());
+
+        // dmidecode rewrites the table address to the offset of the table.
+        uint64_t offset = eps->table_address();
+        if (offset < eps->length() || offset >= data.size())
+            offset = DMI_DUMP_BIN_TABLE_OFFSET;
+        if (offset > data.size())
+            return std::unexpected(error{ errc::truncated, 0xFFFF, uint32_t(data.size()) });
+
+        auto table = data.subspan(size_t(offset));
+        return try_borrow(data.first(eps->length()),
+            table.first(std::min<size_t>(table.size(), eps->table_size())));
+    }
+
+    case dump_format::windows: {
+        auto table = data.subspan(DMI_DUMP_WINDOWS_HEADER_SIZE,
+            load32(data.data() + 4));
+        auto eps = detail::make_entry_point(uint8_t(data[1]), uint8_t(data[2]),
+            uint8_t(data[3]), uint32_t(table.size()));
+
+        return try_borrow(eps, table);
+    }
+
+    case dump_format::tar: {
+        auto [entry_point, table] = tar_members(data);
+        if (table.data() == nullptr)
+            return std::unexpected(error{ errc::malformed });
+
+        return try_borrow(entry_point.first(std::min<size_t>(entry_point.size(),
+            DMI_ENTRY_POINT_MAX)), table);
+    }
+
+    case dump_format::table:
+        return try_borrow({}, data);
+
+    case dump_format::unknown:
+        break;
+    }
+
+    return std::unexpected(error{ errc::unknown_format });
+}
+
+auto source::load(std::span<const std::byte> data) -> source
+{
+    auto result = try_load(data);
+    if (!result) {
+        if (result.error().code == errc::invalid_argument)
+            DMI_THROW(std::invalid_argument("data"));
+
+        DMI_THROW(std::runtime_error(std::string(to_string(result.error().code))));
+    }
+
+    return std::move(*result);
+}
+
+auto detail::read_file(const char *path) noexcept -> result<file_data>
+{
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return std::unexpected(error{ errc::io, 0xFFFF, uint32_t(errno) });
+
+    struct stat st;
+    if (::fstat(fd, &st) < 0) {
+        int code = errno;
+        ::close(fd);
+        return std::unexpected(error{ errc::io, 0xFFFF, uint32_t(code) });
+    }
+
+    size_t size = size_t(st.st_size);
+    void *base = size != 0 ?
+        ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    bool mapped = true;
+
+    // Not mappable (e.g. a pipe or a sysfs file): read it whole.
+    if (base == MAP_FAILED) {
+        size_t capacity = std::max<size_t>(size, 4096);
+        mapped = false;
+        base = std::malloc(capacity);
+        size = 0;
+
+        for (;;) {
+            if (base == nullptr) {
+                ::close(fd);
+                return std::unexpected(error{ errc::io, 0xFFFF, ENOMEM });
+            }
+
+            ssize_t count = ::read(fd, static_cast<std::byte *>(base) + size, capacity - size);
+            if (count < 0) {
+                if (errno == EINTR)
+                    continue;
+                int code = errno;
+                std::free(base);
+                ::close(fd);
+                return std::unexpected(error{ errc::io, 0xFFFF, uint32_t(code) });
+            }
+            if (count == 0)
+                break;
+
+            size += size_t(count);
+            if (size == capacity) {
+                capacity *= 2;
+                void *grown = std::realloc(base, capacity);
+                if (grown == nullptr)
+                    std::free(base);
+                base = grown;
+            }
+        }
+    }
+
+    ::close(fd);
+
+    return file_data{ base, size, mapped };
+}
+
+void detail::release_file(const file_data& file) noexcept
+{
+    if (file.mapped)
+        ::munmap(file.base, file.size);
+    else
+        std::free(file.base);
+}
+
+auto source::try_load_file(const char *path) noexcept -> result<source>
+{
+    auto file = detail::read_file(path);
+    if (!file)
+        return std::unexpected(file.error());
+
+    auto result = try_load({ static_cast<const std::byte *>(file->base), file->size });
+    if (!result) {
+        detail::release_file(*file);
+        return result;
+    }
+
+    result->m_base = file->base;
+    result->m_base_size = file->size;
+    result->m_storage = file->mapped ? storage::mapped : storage::heap;
+
+    return result;
+}
+
+auto source::load_file(const char *path) -> source
+{
+    auto result = try_load_file(path);
+    if (!result) {
+        switch (result.error().code) {
+        case errc::io:
+            if (result.error().offset == ENOMEM)
+                DMI_THROW(std::bad_alloc());
+            DMI_THROW(std::system_error(int(result.error().offset),
+                std::generic_category(), path));
+        case errc::invalid_argument:
+            DMI_THROW(std::invalid_argument("path"));
+        default:
+            DMI_THROW(std::runtime_error(std::string(to_string(result.error().code))));
+        }
+    }
+
+    return std::move(*result);
+}
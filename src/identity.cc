@@ -0,0 +1,261 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/identity.h>
+#include <dmi/source.h>
+#include <dmi/structure.h>
+#include <dmi/table/system.h>
+#include <dmi/table/bios.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <string_view>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// Everything below runs in signal handlers: no allocation, no exceptions,
+// no locks, and no system calls but open(2), read(2) and close(2).
+
+namespace
+{
+    /**
+     * @brief Size of the buffer a structure is read into.
+     *
+     * @details
+     * Kept small enough for an alternate signal stack. The identity strings
+     * come first in their structures, strings past the buffer are reported
+     * empty.
+     */
+    constexpr size_t raw_size = 1024;
+
+    /**
+     * @brief Size of the buffer paths are built in.
+     */
+    constexpr size_t path_size = 512;
+
+    enum class cache_state : int
+    {
+        cold,
+        filling,
+        warm
+    };
+
+    dmi_identity_t cache;
+    std::atomic<cache_state> state{ cache_state::cold };
+
+    static_assert(std::atomic<cache_state>::is_always_lock_free);
+
+    /**
+     * @brief Appends @p text to the path being built at @p out.
+     */
+    bool append(char *&out, char *end, const char *text) noexcept
+    {
+        size_t size = std::strlen(text);
+        if (size_t(end - out) <= size)
+            return false;
+
+        std::memcpy(out, text, size);
+        out += size;
+        *out = '\0';
+
+        return true;
+    }
+
+    /**
+     * @brief Reads the structure of the sysfs entry @p entry (e.g. `1-0`)
+     * into @p buffer.
+     *
+     * @details
+     * A structure longer than the buffer is cut short, its last string
+     * truncated and the following ones missing.
+     *
+     * @return Size of the structure, or a negated `errno` value.
+     */
+    ssize_t read_entry(const char *root, const char *entry,
+        std::byte (&buffer)[raw_size]) noexcept
+    {
+        char path[path_size];
+        char *out = path;
+        char *end = path + sizeof(path);
+
+        *out = '\0';
+        if (!append(out, end, root) || !append(out, end, "/" DMI_SYSFS_ENTRIES "/") ||
+            !append(out, end, entry) || !append(out, end, "/raw"))
+            return -ENAMETOOLONG;
+
+        int fd;
+        do
+            fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        while (fd < 0 && errno == EINTR);
+        if (fd < 0)
+            return -errno;
+
+        // Two bytes are kept to terminate a truncated string set.
+        size_t capacity = sizeof(buffer) - 2;
+        size_t size = 0;
+        int result = 0;
+
+        while (size < capacity) {
+            ssize_t count = ::read(fd, buffer + size, capacity - size);
+            if (count < 0) {
+                if (errno == EINTR)
+                    continue;
+                result = -errno;
+                break;
+            }
+            if (count == 0)
+                break;
+
+            size += size_t(count);
+            if (dmi::detail::structure_size(buffer, buffer + size) == size)
+                break;
+        }
+
+        ::close(fd);
+
+        if (result != 0)
+            return result;
+
+        size_t length = size >= 2 ? uint8_t(buffer[1]) : 0;
+        if (length < sizeof(dmi_header_t) || length > size)
+            return -EINVAL;
+
+        if (dmi::detail::structure_size(buffer, buffer + size) != size) {
+            // Terminate the string cut short, it is truncated anyway.
+            if (size == length || buffer[size - 1] != std::byte(0))
+                buffer[size++] = std::byte(0);
+            buffer[size++] = std::byte(0);
+        }
+
+        return ssize_t(size);
+    }
+
+    /**
+     * @brief Copies the string referenced at @p offset in @p structure into
+     * @p out, truncated to its size.
+     */
+    void copy_string(const dmi::structure& structure, size_t offset,
+        char (&out)[DMI_IDENTITY_STRING_SIZE]) noexcept
+    {
+        std::string_view value;
+        if (structure.covers(offset, 1))
+            value = structure.string(uint8_t(structure.data()[offset]));
+
+        size_t size = std::min(value.size(), sizeof(out) - 1);
+        std::memcpy(out, value.data(), size);
+        out[size] = '\0';
+    }
+
+    /**
+     * @brief Formats @p uuid into @p out, SMBIOS 2.6+ byte order.
+     */
+    void format_uuid(const uint8_t (&uuid)[16], char (&out)[DMI_IDENTITY_UUID_SIZE]) noexcept
+    {
+        static constexpr char digits[] = "0123456789abcdef";
+        static constexpr uint8_t order[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+        bool zero = true;
+        bool ones = true;
+
+        for (uint8_t byte : uuid) {
+            zero = zero && byte == 0x00;
+            ones = ones && byte == 0xFF;
+        }
+
+        if (zero || ones) {
+            out[0] = '\0';
+            return;
+        }
+
+        char *pos = out;
+
+        for (size_t i = 0; i < 16; i++) {
+            if (i == 4 || i == 6 || i == 8 || i == 10)
+                *pos++ = '-';
+            *pos++ = digits[uuid[order[i]] >> 4];
+            *pos++ = digits[uuid[order[i]] & 0x0F];
+        }
+
+        *pos = '\0';
+    }
+
+    /**
+     * @brief Reads the identity as dmi_identity_read() does, clobbering
+     * `errno`.
+     */
+    int read_identity(const char *root, dmi_identity_t *identity) noexcept
+    {
+        std::byte buffer[raw_size];
+
+        if (root == nullptr)
+            root = "";
+
+        std::memset(identity, 0, sizeof(*identity));
+
+        ssize_t size = read_entry(root, "1-0", buffer);
+        if (size < 0)
+            return int(size);
+
+        dmi::structure system(buffer, size_t(size));
+
+        if (system.covers(offsetof(dmi_system_table, uuid), sizeof(identity->uuid))) {
+            std::memcpy(identity->uuid, buffer + offsetof(dmi_system_table, uuid), sizeof(identity->uuid));
+            format_uuid(identity->uuid, identity->uuid_str);
+        }
+
+        copy_string(system, offsetof(dmi_system_table, product), identity->product_name);
+        copy_string(system, offsetof(dmi_system_table, serial_number), identity->serial_number);
+
+        size = read_entry(root, "0-0", buffer);
+        if (size < 0 && size != -ENOENT)
+            return int(size);
+
+        if (size > 0) {
+            dmi::structure bios(buffer, size_t(size));
+            copy_string(bios, offsetof(dmi_bios_table, bios_version), identity->bios_version);
+        }
+
+        return 0;
+    }
+}
+
+int dmi_identity_read(const char *root, dmi_identity_t *identity)
+{
+    // Leave errno alone, as the interrupted code may still read it.
+    int saved = errno;
+    int result = read_identity(root, identity);
+    errno = saved;
+
+    return result;
+}
+
+int dmi_identity_warm(const char *root)
+{
+    dmi_identity_t identity;
+
+    int result = dmi_identity_read(root, &identity);
+    if (result != 0)
+        return result;
+
+    auto expected = cache_state::cold;
+    if (state.compare_exchange_strong(expected, cache_state::filling, std::memory_order_acquire)) {
+        cache = identity;
+        state.store(cache_state::warm, std::memory_order_release);
+    }
+
+    return 0;
+}
+
+int dmi_identity_get(dmi_identity_t *identity)
+{
+    if (state.load(std::memory_order_acquire) == cache_state::warm) {
+        *identity = cache;
+        return 0;
+    }
+
+    return dmi_identity_read(nullptr, identity);
+}
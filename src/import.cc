@@ -0,0 +1,1005 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/import.h>
+#include <dmi/entry.h>
+#include <dmi/table/system.h>
+#include <dmi/table/cache.h>
+#include <dmi/table/cooling-device.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+
+#include "cpu.h"
+#include "entry-point.h"
+#include "file.h"
+
+using namespace dmi;
+
+namespace
+{
+    constexpr size_t npos = size_t(-1);
+
+    /**
+     * @brief Fields dmidecode prints for the hand-written tables.
+     */
+    constexpr char system_labels[] =
+        "Manufacturer\0" "\0"
+        "Product Name\0" "\0"
+        "Version\0" "\0"
+        "Serial Number\0" "\0"
+        "UUID\0" "\0"
+        "Wake-up Type\0" "\0"
+        "SKU Number\0" "\0"
+        "Family\0" "\0";
+
+    constexpr detail::text_field system_text_fields[] = {
+        { 0, 12, offsetof(dmi_system_table, manufacturer), 1, detail::text_kind::string, 0 },
+        { 14, 12, offsetof(dmi_system_table, product), 1, detail::text_kind::string, 0 },
+        { 28, 7, offsetof(dmi_system_table, version), 1, detail::text_kind::string, 0 },
+        { 37, 13, offsetof(dmi_system_table, serial_number), 1, detail::text_kind::string, 0 },
+        { 52, 4, offsetof(dmi_system_table, uuid), 16, detail::text_kind::uuid, 0 },
+        { 58, 12, offsetof(dmi_system_table, wakeup_type), 1, detail::text_kind::enumeration, 0 },
+        { 72, 10, offsetof(dmi_system_table, sku_number), 1, detail::text_kind::string, 0 },
+        { 84, 6, offsetof(dmi_system_table, family), 1, detail::text_kind::string, 0 }
+    };
+
+    std::optional<unsigned> system_text_enum(unsigned, std::string_view name) noexcept
+    {
+        return detail::find_name<table::system_wakeup>(name);
+    }
+
+    constexpr char cache_labels[] =
+        "Socket Designation\0" "\0"
+        "Speed\0" "ns\0";
+
+    constexpr detail::text_field cache_text_fields[] = {
+        { 0, 18, offsetof(dmi_cache_table, socket_designation), 1, detail::text_kind::string, 0 },
+        { 20, 5, offsetof(dmi_cache_table, speed), 1, detail::text_kind::integer, 0 }
+    };
+
+    constexpr char cooling_device_labels[] =
+        "Temperature Probe Handle\0" "\0"
+        "Cooling Unit Group\0" "\0"
+        "OEM-specific Information\0" "\0"
+        "Nominal Speed\0" "rpm\0"
+        "Description\0" "\0";
+
+    constexpr detail::text_field cooling_device_text_fields[] = {
+        { 0, 24, offsetof(dmi_cooling_device_table, temperature_probe_handle), 2, detail::text_kind::handle, 0 },
+        { 26, 18, offsetof(dmi_cooling_device_table, cooling_unit_group), 1, detail::text_kind::integer, 0 },
+        { 46, 24, offsetof(dmi_cooling_device_table, oem_specific), 4, detail::text_kind::integer, 0 },
+        { 72, 13, offsetof(dmi_cooling_device_table, nominal_speed), 2, detail::text_kind::integer, 0 },
+        { 90, 11, offsetof(dmi_cooling_device_table, description), 1, detail::text_kind::string, 0 }
+    };
+
+    /**
+     * @brief Line of text: its first colon, that of `Label: value` lines,
+     * and its end, offsets in the text.
+     */
+    struct line
+    {
+        size_t begin;
+        size_t colon; //< end if the line has none
+        size_t end;
+    };
+
+    /**
+     * @brief Splitting state shared by the kernels.
+     *
+     * @details
+     * The vector kernels compare a block against `\n` and `:` at once and
+     * hand both masks, @p Step bits per byte, to block(), which walks the
+     * newlines in order and keeps the first colon of each line. Lines are
+     * gathered in batches. When a batch is full, splitting resumes at the
+     * start of the first line not in it, rescanning at most one line.
+     */
+    struct splitter
+    {
+        static constexpr size_t batch = 64;
+
+        std::array<line, batch> lines;
+        size_t count = 0;
+        size_t begin = 0;
+        size_t colon = npos;
+
+        inline bool emit(size_t end) noexcept
+        {
+            if (count == batch)
+                return false;
+
+            lines[count++] = { begin, colon == npos ? end : colon, end };
+            begin = end + 1;
+            colon = npos;
+
+            return true;
+        }
+
+        /**
+         * @return `false` once the batch is full.
+         */
+        template <unsigned Step>
+        inline bool block(uint64_t newlines, uint64_t colons, size_t pos) noexcept
+        {
+            for (;;) {
+                uint64_t before = newlines != 0 ? colons & ((newlines & -newlines) - 1) : colons;
+                if (colon == npos && before != 0)
+                    colon = pos + unsigned(std::countr_zero(before)) / Step;
+
+                if (newlines == 0)
+                    return true;
+
+                unsigned bit = unsigned(std::countr_zero(newlines));
+                if (!emit(pos + bit / Step))
+                    return false;
+
+                uint64_t rest = bit == 63 ? 0 : ~uint64_t(0) << (bit + 1);
+                newlines &= rest;
+                colons &= rest;
+            }
+        }
+
+        /**
+         * @brief Scalar kernel, also used for the bytes that do not fill a
+         * vector.
+         */
+        inline void tail(std::string_view text, size_t pos) noexcept
+        {
+            for (; pos < text.size(); pos++) {
+                if (text[pos] == ':' && colon == npos)
+                    colon = pos;
+                else if (text[pos] == '\n' && !emit(pos))
+                    return;
+            }
+
+            if (begin < text.size() && emit(text.size()))
+                begin = text.size();
+        }
+
+        /**
+         * @brief Restarts at the start of the first line not gathered.
+         */
+        inline size_t restart() noexcept
+        {
+            count = 0;
+            colon = npos;
+            return begin;
+        }
+    };
+
+#if defined(DMI_HAVE_X86)
+    /**
+     * @brief SSE2 kernel.
+     */
+    __attribute__((target("sse2")))
+    void split_sse2(std::string_view text, splitter& state) noexcept
+    {
+        constexpr unsigned width = 16;
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i colon = _mm_set1_epi8(':');
+
+        size_t pos = state.restart();
+
+        for (; pos + width <= text.size(); pos += width) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text.data() + pos));
+            uint64_t newlines = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, newline)));
+            uint64_t colons = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, colon)));
+
+            if ((newlines | colons) != 0 && !state.block<1>(newlines, colons, pos))
+                return;
+        }
+
+        state.tail(text, pos);
+    }
+
+    /**
+     * @brief AVX2 kernel.
+     */
+    __attribute__((target("avx2")))
+    void split_avx2(std::string_view text, splitter& state) noexcept
+    {
+        constexpr unsigned width = 32;
+        const __m256i newline = _mm256_set1_epi8('\n');
+        const __m256i colon = _mm256_set1_epi8(':');
+
+        size_t pos = state.restart();
+
+        for (; pos + width <= text.size(); pos += width) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text.data() + pos));
+            uint64_t newlines = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline)));
+            uint64_t colons = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, colon)));
+
+            if ((newlines | colons) != 0 && !state.block<1>(newlines, colons, pos))
+                return;
+        }
+
+        state.tail(text, pos);
+    }
+#endif
+
+#if defined(DMI_HAVE_NEON)
+    /**
+     * @brief NEON kernel, with a nibble per byte in the masks as in the
+     * string set scanner.
+     */
+    void split_neon(std::string_view text, splitter& state) noexcept
+    {
+        constexpr unsigned width = 16;
+
+        size_t pos = state.restart();
+
+        auto mask = [](uint8x16_t eq) {
+            return vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0) & 0x1111111111111111ull;
+        };
+
+        for (; pos + width <= text.size(); pos += width) {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(text.data() + pos));
+            uint64_t newlines = mask(vceqq_u8(v, vdupq_n_u8('\n')));
+            uint64_t colons = mask(vceqq_u8(v, vdupq_n_u8(':')));
+
+            if ((newlines | colons) != 0 && !state.block<4>(newlines, colons, pos))
+                return;
+        }
+
+        state.tail(text, pos);
+    }
+#endif
+
+    /**
+     * @brief Gathers the next batch of lines of @p text into @p state.
+     */
+    void split(std::string_view text, splitter& state) noexcept
+    {
+        switch (detail::cpu_simd()) {
+#if defined(DMI_HAVE_X86)
+        case detail::simd::avx2:
+            return split_avx2(text, state);
+        case detail::simd::sse2:
+            return split_sse2(text, state);
+#endif
+#if defined(DMI_HAVE_NEON)
+        case detail::simd::neon:
+            return split_neon(text, state);
+#endif
+        default:
+            return state.tail(text, state.restart());
+        }
+    }
+
+    inline std::string_view trim(std::string_view text) noexcept
+    {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+            text.remove_prefix(1);
+        while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+            text.remove_suffix(1);
+
+        return text;
+    }
+
+    inline int hex_digit(char c) noexcept
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        return -1;
+    }
+
+    /**
+     * @brief Whether @p text is a line of a dmidecode hex dump: bytes as
+     * two hex digits, separated by single spaces.
+     */
+    bool is_hex_line(std::string_view text) noexcept
+    {
+        if (text.empty())
+            return false;
+
+        for (size_t i = 0; i < text.size(); i += 3) {
+            if (i + 2 > text.size() || hex_digit(text[i]) < 0 || hex_digit(text[i + 1]) < 0)
+                return false;
+            if (i + 2 < text.size() && text[i + 2] != ' ')
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Parses a whole decimal or `0x` hexadecimal number, optionally
+     * followed by a space and @p unit.
+     */
+    std::optional<uint64_t> parse_number(std::string_view text, std::string_view unit) noexcept
+    {
+        int base = 10;
+        if (text.starts_with("0x") || text.starts_with("0X")) {
+            text.remove_prefix(2);
+            base = 16;
+        }
+
+        uint64_t value;
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+        if (ec != std::errc() || end == text.data())
+            return std::nullopt;
+
+        std::string_view rest(end, size_t(text.data() + text.size() - end));
+        if (!rest.empty() && (unit.empty() || rest.size() != unit.size() + 1 ||
+                rest[0] != ' ' || rest.substr(1) != unit))
+            return std::nullopt;
+
+        return value;
+    }
+
+    /**
+     * @brief Parses a UUID into @p out, in the byte order of SMBIOS 2.6+
+     * (the first three fields little-endian) if @p swapped.
+     */
+    bool parse_uuid(std::string_view text, bool swapped, std::byte *out) noexcept
+    {
+        static constexpr uint8_t order[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+        if (text.size() != 36)
+            return false;
+
+        size_t pos = 0;
+        for (size_t i = 0; i < 16; i++) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) {
+                if (text[pos++] != '-')
+                    return false;
+            }
+
+            int high = hex_digit(text[pos]);
+            int low = hex_digit(text[pos + 1]);
+            if (high < 0 || low < 0)
+                return false;
+
+            out[swapped ? order[i] : i] = std::byte(high << 4 | low);
+            pos += 2;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Growable heap buffer, reporting allocation failures rather than
+     * throwing.
+     */
+    class buffer
+    {
+    private:
+        std::byte *m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+
+    public:
+        buffer() noexcept = default;
+        buffer(const buffer&) = delete;
+        buffer& operator=(const buffer&) = delete;
+        ~buffer() { std::free(m_data); }
+
+        inline std::byte *data() const noexcept { return m_data; }
+        inline size_t size() const noexcept { return m_size; }
+        inline void resize(size_t size) noexcept { m_size = std::min(size, m_size); }
+
+        bool append(const void *data, size_t size) noexcept
+        {
+            if (m_capacity - m_size < size) {
+                size_t capacity = std::max({ m_capacity * 2, m_size + size, size_t(4096) });
+                void *grown = std::realloc(m_data, capacity);
+                if (grown == nullptr)
+                    return false;
+
+                m_data = static_cast<std::byte *>(grown);
+                m_capacity = capacity;
+            }
+
+            if (size != 0)
+                std::memcpy(m_data + m_size, data, size);
+            m_size += size;
+
+            return true;
+        }
+
+        inline bool push(std::byte byte) noexcept
+        {
+            return append(&byte, 1);
+        }
+
+        /**
+         * @brief Hands the memory over to the caller, to be released with
+         * free(3).
+         */
+        inline std::byte *release() noexcept
+        {
+            std::byte *data = m_data;
+            m_data = nullptr;
+            m_size = m_capacity = 0;
+            return data;
+        }
+    };
+
+    /**
+     * @brief Rebuilds a structure table from dmidecode text, a line at a
+     * time.
+     */
+    class text_parser
+    {
+    private:
+        enum class section : uint8_t
+        {
+            fields,  //< `Label: value` lines
+            data,    //< Hex dump of the formatted area
+            strings  //< Hex dumps or text of the strings
+        };
+
+        std::string_view m_text;
+        buffer m_table;
+        buffer m_strings;
+        std::array<std::byte, 0xFF> m_formatted;
+        size_t m_length;
+        size_t m_dumped;
+        unsigned m_string_count;
+        detail::text_table m_fields;
+        section m_section;
+        bool m_open;
+        bool m_raw;
+        size_t m_structure;
+        size_t m_pending;
+        size_t m_pending_end;
+        size_t m_pending_mark;
+        std::array<uint8_t, 3> m_version;
+        bool m_has_version;
+        error m_error;
+
+    public:
+        explicit text_parser(std::string_view text) noexcept
+            : m_text(text),
+              m_length(0),
+              m_dumped(0),
+              m_string_count(0),
+              m_section(section::fields),
+              m_open(false),
+              m_raw(false),
+              m_structure(0),
+              m_pending(npos),
+              m_pending_end(0),
+              m_pending_mark(0),
+              m_version{},
+              m_has_version(false),
+              m_error{ errc::unknown_format }
+        {
+        }
+
+        /**
+         * @brief Parses the line @p text of the input, at @p offset, whose
+         * first colon is at @p colon (`npos` if none).
+         */
+        bool line(std::string_view text, size_t offset, size_t colon) noexcept
+        {
+            size_t depth = 0;
+            while (depth < text.size() && text[depth] == '\t')
+                depth++;
+
+            if (depth == 0) {
+                if (!flush_pending())
+                    return false;
+                if (text.starts_with("Handle "))
+                    return open(text, offset);
+                if (text.starts_with("SMBIOS ") || text.starts_with("Legacy DMI "))
+                    version(text);
+                return true;
+            }
+
+            if (!m_open)
+                return true;
+
+            if (depth == 1) {
+                if (!flush_pending())
+                    return false;
+
+                std::string_view key = trim(text.substr(0, colon == npos ? text.size() : colon));
+                std::string_view value = colon == npos ? std::string_view() : trim(text.substr(colon + 1));
+
+                if (value.empty() && key == "Header and Data") {
+                    m_section = section::data;
+                    m_raw = true;
+                    m_dumped = 0;
+                } else if (value.empty() && key == "Strings" && m_raw) {
+                    m_section = section::strings;
+                } else {
+                    m_section = section::fields;
+                    if (!m_raw)
+                        return field(key, value);
+                }
+
+                return true;
+            }
+
+            text = trim(text);
+
+            switch (m_section) {
+            case section::data:
+                if (!is_hex_line(text))
+                    return fail(errc::malformed, offset);
+
+                for (size_t i = 0; i < text.size(); i += 3) {
+                    if (m_dumped == m_formatted.size())
+                        return fail(errc::bad_length, offset);
+                    m_formatted[m_dumped++] = std::byte(hex_digit(text[i]) << 4 | hex_digit(text[i + 1]));
+                }
+                return true;
+
+            case section::strings:
+                return string_line(text, offset);
+
+            case section::fields:
+                break;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Closes the last structure.
+         */
+        bool finish() noexcept
+        {
+            return flush_pending() && close();
+        }
+
+        inline const error& failure() const noexcept { return m_error; }
+        inline buffer& table() noexcept { return m_table; }
+        inline bool has_version() const noexcept { return m_has_version; }
+        inline const std::array<uint8_t, 3>& smbios_version() const noexcept { return m_version; }
+
+    private:
+        bool fail(errc code, size_t offset) noexcept
+        {
+            m_error = { code, 0xFFFF, uint32_t(std::min<size_t>(offset, UINT32_MAX)) };
+            return false;
+        }
+
+        bool out_of_memory() noexcept
+        {
+            m_error = { errc::io, 0xFFFF, ENOMEM };
+            return false;
+        }
+
+        /**
+         * @brief Parses `SMBIOS 3.2.0 present.` and `Legacy DMI 2.0 present.`
+         */
+        void version(std::string_view text) noexcept
+        {
+            text.remove_prefix(text.find(' ') + 1);
+            if (text.starts_with("DMI "))
+                text.remove_prefix(4);
+
+            std::array<uint8_t, 3> version{};
+            const char *pos = text.data();
+            const char *end = text.data() + text.size();
+
+            for (size_t i = 0; i < version.size(); i++) {
+                auto [next, ec] = std::from_chars(pos, end, version[i]);
+                if (ec != std::errc()) {
+                    if (i < 2)
+                        return;
+                    break;
+                }
+
+                pos = next;
+                if (pos == end || *pos != '.')
+                    break;
+                pos++;
+            }
+
+            m_version = version;
+            m_has_version = true;
+        }
+
+        /**
+         * @brief Parses `Handle 0x0001, DMI type 1, 27 bytes`, which starts
+         * a structure.
+         */
+        bool open(std::string_view text, size_t offset) noexcept
+        {
+            if (!close())
+                return false;
+
+            unsigned handle, type, length;
+            const char *pos = text.data() + 7;
+            const char *end = text.data() + text.size();
+
+            auto expect = [&](std::string_view literal) {
+                if (size_t(end - pos) < literal.size() || std::string_view(pos, literal.size()) != literal)
+                    return false;
+                pos += literal.size();
+                return true;
+            };
+            auto number = [&](unsigned& value, int base) {
+                auto [next, ec] = std::from_chars(pos, end, value, base);
+                pos = next;
+                return ec == std::errc();
+            };
+
+            if (!expect("0x") || !number(handle, 16) || !expect(", DMI type ") ||
+                !number(type, 10) || !expect(", ") || !number(length, 10) ||
+                !expect(" bytes") || trim({ pos, size_t(end - pos) }) != "" ||
+                handle > 0xFFFF || type > 0xFF || length < sizeof(dmi_header_t) ||
+                length > m_formatted.size())
+                return fail(errc::malformed, offset);
+
+            m_open = true;
+            m_raw = false;
+            m_section = section::fields;
+            m_structure = offset;
+            m_length = length;
+            m_dumped = 0;
+            m_string_count = 0;
+            m_strings.resize(0);
+            m_fields = detail::text_table_of(table_type(type));
+
+            m_formatted.fill(std::byte(0));
+            m_formatted[0] = std::byte(type);
+            m_formatted[1] = std::byte(length);
+            m_formatted[2] = std::byte(handle & 0xFF);
+            m_formatted[3] = std::byte(handle >> 8);
+
+            // Fields not printed reference no structure.
+            for (const auto& field : m_fields.fields)
+                if (field.kind == detail::text_kind::handle && field.offset + 2u <= length)
+                    m_formatted[field.offset] = m_formatted[field.offset + 1] = std::byte(0xFF);
+
+            return true;
+        }
+
+        /**
+         * @brief Appends the structure being parsed to the table.
+         */
+        bool close() noexcept
+        {
+            if (!m_open)
+                return true;
+
+            m_open = false;
+
+            size_t length = m_length;
+            if (m_raw) {
+                if (m_dumped < sizeof(dmi_header_t) || uint8_t(m_formatted[1]) != m_dumped)
+                    return fail(errc::bad_length, m_structure);
+                length = m_dumped;
+            }
+
+            if (m_strings.size() != 0 && m_strings.data()[m_strings.size() - 1] != std::byte(0) &&
+                !m_strings.push(std::byte(0)))
+                return out_of_memory();
+
+            if (!m_table.append(m_formatted.data(), length) ||
+                !m_table.append(m_strings.data(), m_strings.size()) ||
+                (m_strings.size() == 0 && !m_table.push(std::byte(0))) ||
+                !m_table.push(std::byte(0)))
+                return out_of_memory();
+
+            return true;
+        }
+
+        /**
+         * @brief Adds @p text to the string set, unless already there.
+         *
+         * @return Its string number, `0` if the set is full.
+         */
+        unsigned add_string(std::string_view text) noexcept
+        {
+            const char *strings = reinterpret_cast<const char *>(m_strings.data());
+
+            for (size_t pos = 0, number = 1; pos < m_strings.size(); number++) {
+                std::string_view string(strings + pos);
+                if (string == text)
+                    return unsigned(number);
+                pos += string.size() + 1;
+            }
+
+            if (m_string_count == 0xFF)
+                return 0;
+            if (!m_strings.append(text.data(), text.size()) || !m_strings.push(std::byte(0))) {
+                out_of_memory();
+                return 0;
+            }
+
+            return ++m_string_count;
+        }
+
+        /**
+         * @brief Stores the value of the `Label: value` line @p key.
+         *
+         * @details
+         * Values that do not parse (words dmidecode prints for special
+         * values, numbers in other units) leave the field as it is.
+         */
+        bool field(std::string_view key, std::string_view value) noexcept
+        {
+            auto type = table_type(uint8_t(m_formatted[0]));
+
+            // The strings of OEM Strings and System Configuration Options
+            // are printed as `String 1: ...` and `Option 1: ...`.
+            if ((type == table_type::oem_strings && key.starts_with("String ")) ||
+                (type == table_type::system_config && key.starts_with("Option "))) {
+                if (!value.empty() && m_length > sizeof(dmi_header_t))
+                    m_formatted[sizeof(dmi_header_t)] = std::byte(add_string(value));
+                return m_error.code != errc::io;
+            }
+
+            for (const auto& field : m_fields.fields) {
+                if (!detail::same_label(m_fields.label(field), key))
+                    continue;
+                if (field.offset + size_t(field.size) > m_length)
+                    return true;
+
+                std::byte *out = m_formatted.data() + field.offset;
+
+                switch (field.kind) {
+                case detail::text_kind::string:
+                    if (!value.empty() && value != "Not Specified") {
+                        *out = std::byte(add_string(value));
+                        if (m_error.code == errc::io)
+                            return false;
+                    }
+                    break;
+
+                case detail::text_kind::integer:
+                    if (auto number = parse_number(value, m_fields.unit(field));
+                        number && (field.size == 8 || *number >> (field.size * 8) == 0)) {
+                        for (size_t i = 0; i < field.size; i++)
+                            out[i] = std::byte(*number >> (i * 8));
+                    }
+                    break;
+
+                case detail::text_kind::handle:
+                    if (auto number = parse_number(value, {});
+                        number && value.starts_with("0x") && *number <= 0xFFFF) {
+                        out[0] = std::byte(*number & 0xFF);
+                        out[1] = std::byte(*number >> 8);
+                    }
+                    break;
+
+                case detail::text_kind::enumeration:
+                    if (m_fields.lookup != nullptr) {
+                        if (auto number = m_fields.lookup(field.enumeration, value))
+                            *out = std::byte(*number);
+                    }
+                    break;
+
+                case detail::text_kind::uuid:
+                    if (value == "Not Present")
+                        std::fill_n(out, field.size, std::byte(0xFF));
+                    else
+                        parse_uuid(value, !m_has_version || m_version >= std::array<uint8_t, 3>{ 2, 6, 0 }, out);
+                    break;
+                }
+
+                return true;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Parses a line of the `Strings` section.
+         *
+         * @details
+         * dmidecode dumps each string in hex, terminating NUL included, then
+         * prints it quoted; dmi-dump prints the text alone. Hex lines are
+         * taken as bytes tentatively, and as text if no quoted line follows
+         * them.
+         */
+        bool string_line(std::string_view text, size_t offset) noexcept
+        {
+            if (text.starts_with('"')) {
+                m_pending = npos;
+                return true;
+            }
+
+            if (is_hex_line(text)) {
+                if (m_pending == npos) {
+                    m_pending = offset;
+                    m_pending_mark = m_strings.size();
+                }
+                m_pending_end = size_t(text.data() - m_text.data()) + text.size();
+
+                for (size_t i = 0; i < text.size(); i += 3)
+                    if (!m_strings.push(std::byte(hex_digit(text[i]) << 4 | hex_digit(text[i + 1]))))
+                        return out_of_memory();
+
+                return true;
+            }
+
+            if (!flush_pending())
+                return false;
+            if (text.empty())
+                return true;
+            if (!m_strings.append(text.data(), text.size()) || !m_strings.push(std::byte(0)))
+                return out_of_memory();
+
+            return true;
+        }
+
+        /**
+         * @brief Takes the hex lines not followed by a quoted line as text.
+         */
+        bool flush_pending() noexcept
+        {
+            if (m_pending == npos)
+                return true;
+
+            m_strings.resize(m_pending_mark);
+
+            std::string_view lines = m_text.substr(m_pending, m_pending_end - m_pending);
+            m_pending = npos;
+
+            while (!lines.empty()) {
+                size_t end = std::min(lines.find('\n'), lines.size());
+                auto text = trim(lines.substr(0, end));
+                lines.remove_prefix(std::min(end + 1, lines.size()));
+
+                if (!m_strings.append(text.data(), text.size()) || !m_strings.push(std::byte(0)))
+                    return out_of_memory();
+            }
+
+            return true;
+        }
+    };
+
+    /**
+     * @brief Files shared by the workers of import_text_files().
+     */
+    struct import_job
+    {
+        std::span<const char *const> paths;
+        detail::import_callback callback;
+        void *context;
+        std::atomic<size_t> next;
+    };
+
+    /**
+     * @brief Imports the next file not taken by another worker until none
+     * is left.
+     *
+     * @details
+     * Started with pthread_create(3) rather than std::thread, whose state
+     * type has a vtable needing relocation when the library is loaded.
+     */
+    void *import_worker(void *argument) noexcept
+    {
+        auto& job = *static_cast<import_job *>(argument);
+
+        for (size_t index; (index = job.next.fetch_add(1, std::memory_order_relaxed)) < job.paths.size();) {
+            auto file = detail::read_file(job.paths[index]);
+            if (!file) {
+                job.callback(job.context, index, std::unexpected(file.error()));
+                continue;
+            }
+
+            auto result = source::try_import_text({ static_cast<const char *>(file->base), file->size });
+            detail::release_file(*file);
+
+            job.callback(job.context, index, std::move(result));
+        }
+
+        return nullptr;
+    }
+}
+
+auto detail::text_table_of(table_type type) noexcept -> text_table
+{
+    switch (type) {
+    case table_type::system:
+        return { system_text_fields, system_labels, system_text_enum };
+    case table_type::cache:
+        return { cache_text_fields, cache_labels, nullptr };
+    case table_type::cooling_device:
+        return { cooling_device_text_fields, cooling_device_labels, nullptr };
+    default:
+        return generated_text_table(type);
+    }
+}
+
+auto source::try_import_text(std::string_view text) noexcept -> result<source>
+{
+    text_parser parser(text);
+    splitter state;
+
+    while (state.begin < text.size()) {
+        split(text, state);
+
+        for (size_t i = 0; i < state.count; i++) {
+            const line& line = state.lines[i];
+            size_t colon = line.colon < line.end ? line.colon - line.begin : npos;
+
+            if (!parser.line(text.substr(line.begin, line.end - line.begin), line.begin, colon))
+                return std::unexpected(parser.failure());
+        }
+    }
+
+    if (!parser.finish())
+        return std::unexpected(parser.failure());
+
+    buffer& table = parser.table();
+    if (table.size() == 0)
+        return std::unexpected(error{ errc::unknown_format });
+
+    std::array<std::byte, sizeof(dmi_entry_v30_t)> eps{};
+    if (parser.has_version()) {
+        const auto& version = parser.smbios_version();
+        eps = detail::make_entry_point(version[0], version[1], version[2], uint32_t(table.size()));
+    }
+
+    size_t size = table.size();
+    std::byte *data = table.release();
+
+    auto result = try_borrow(parser.has_version() ? std::span<const std::byte>(eps) :
+        std::span<const std::byte>(), { data, size });
+    if (!result) {
+        std::free(data);
+        return result;
+    }
+
+    result->m_base = data;
+    result->m_base_size = size;
+    result->m_storage = storage::heap;
+
+    return result;
+}
+
+auto source::import_text(std::string_view text) -> source
+{
+    auto result = try_import_text(text);
+    if (!result) {
+        if (result.error().code == errc::io)
+            DMI_THROW(std::bad_alloc());
+
+        DMI_THROW(std::runtime_error(std::string(to_string(result.error().code))));
+    }
+
+    return std::move(*result);
+}
+
+void detail::import_text_files(std::span<const char *const> paths, unsigned threads,
+    import_callback callback, void *context)
+{
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    threads = unsigned(std::min<size_t>(threads, paths.size()));
+
+    import_job job{ paths, callback, context, { 0 } };
+
+    // The calling thread is one of the workers. Reserving first, nothing
+    // throws once a thread is started.
+    std::vector<pthread_t> workers;
+    workers.reserve(threads > 0 ? threads - 1 : 0);
+
+    for (unsigned i = 1; i < threads; i++) {
+        pthread_t worker;
+        if (::pthread_create(&worker, nullptr, import_worker, &job) != 0)
+            break;
+        workers.push_back(worker);
+    }
+
+    import_worker(&job);
+
+    for (pthread_t worker : workers)
+        ::pthread_join(worker, nullptr);
+}
@@ -0,0 +1,273 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/scan.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "cpu.h"
+
+using namespace dmi;
+
+namespace
+{
+    inline uint32_t load32(const void *ptr) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief First four bytes of each anchor string, in host byte order.
+     */
+    struct anchor_words
+    {
+        uint32_t v30;
+        uint32_t v21;
+        uint32_t legacy;
+
+        anchor_words() noexcept
+            : v30(load32(DMI_ANCHOR_V30)),
+              v21(load32(DMI_ANCHOR_V21)),
+              legacy(load32(DMI_ANCHOR_LEGACY))
+        {
+        }
+    };
+
+    /**
+     * @brief Classifies the paragraph at @p offset and appends it to
+     * @p result if it starts with an anchor string.
+     */
+    void check(std::span<const std::byte> data, size_t offset,
+        const anchor_words& words, std::vector<entry_candidate>& result)
+    {
+        const std::byte *ptr = data.data() + offset;
+        size_t avail = data.size() - offset;
+
+        if (avail < sizeof(uint32_t))
+            return;
+
+        uint32_t word = load32(ptr);
+
+        entry_type type;
+
+        if (word == words.v30)
+            type = entry_type::v30;
+        else if (word == words.v21)
+            type = entry_type::v21;
+        else if (word == words.legacy)
+            type = entry_type::legacy;
+        else
+            return;
+
+        if (type != entry_type::v21 && (avail < 5 || ptr[4] != std::byte('_')))
+            return;
+
+        auto eps = entry::parse(ptr, avail);
+        result.push_back({ offset, type, eps.has_value() });
+    }
+
+    /**
+     * @brief Portable kernel, checks paragraphs [@p first, @p last).
+     */
+    void scan_scalar(std::span<const std::byte> data, size_t first,
+        size_t last, const anchor_words& words,
+        std::vector<entry_candidate>& result)
+    {
+        for (size_t i = first; i < last; i++) {
+            uint32_t word = load32(data.data() + i * DMI_ANCHOR_ALIGNMENT);
+
+            if (word == words.v30 || word == words.v21 || word == words.legacy)
+                check(data, i * DMI_ANCHOR_ALIGNMENT, words, result);
+        }
+    }
+
+#if defined(DMI_HAVE_X86)
+    /**
+     * @brief SSE2 kernel, gathers the first word of 4 paragraphs at a time.
+     *
+     * @details
+     * Checks paragraphs from @p first up to @p last and returns the index of
+     * the first paragraph left unchecked. The other vector kernels follow the
+     * same convention.
+     */
+    __attribute__((target("sse2")))
+    size_t scan_sse2(std::span<const std::byte> data, size_t first,
+        size_t last, const anchor_words& words,
+        std::vector<entry_candidate>& result)
+    {
+        const __m128i v30 = _mm_set1_epi32(int(words.v30));
+        const __m128i v21 = _mm_set1_epi32(int(words.v21));
+        const __m128i legacy = _mm_set1_epi32(int(words.legacy));
+
+        size_t i = first;
+
+        for (; i + 4 <= last; i += 4) {
+            auto ptr = reinterpret_cast<const __m128i *>(
+                data.data() + i * DMI_ANCHOR_ALIGNMENT);
+
+            __m128i p0 = _mm_loadu_si128(ptr + 0);
+            __m128i p1 = _mm_loadu_si128(ptr + 1);
+            __m128i p2 = _mm_loadu_si128(ptr + 2);
+            __m128i p3 = _mm_loadu_si128(ptr + 3);
+
+            // Word 0 of p0, p1, p2 and p3.
+            __m128i w = _mm_unpacklo_epi64(
+                _mm_unpacklo_epi32(p0, p1), _mm_unpacklo_epi32(p2, p3));
+
+            __m128i hit = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(w, v30), _mm_cmpeq_epi32(w, v21)),
+                _mm_cmpeq_epi32(w, legacy));
+
+            unsigned mask = unsigned(_mm_movemask_ps(_mm_castsi128_ps(hit)));
+
+            while (mask != 0) {
+                unsigned bit = unsigned(__builtin_ctz(mask));
+                check(data, (i + bit) * DMI_ANCHOR_ALIGNMENT, words, result);
+                mask &= mask - 1;
+            }
+        }
+
+        return i;
+    }
+
+    /**
+     * @brief AVX2 kernel, gathers the first word of 8 paragraphs at a time.
+     */
+    __attribute__((target("avx2")))
+    size_t scan_avx2(std::span<const std::byte> data, size_t first,
+        size_t last, const anchor_words& words,
+        std::vector<entry_candidate>& result)
+    {
+        const __m256i v30 = _mm256_set1_epi32(int(words.v30));
+        const __m256i v21 = _mm256_set1_epi32(int(words.v21));
+        const __m256i legacy = _mm256_set1_epi32(int(words.legacy));
+
+        size_t i = first;
+
+        for (; i + 8 <= last; i += 8) {
+            auto ptr = reinterpret_cast<const __m256i *>(
+                data.data() + i * DMI_ANCHOR_ALIGNMENT);
+
+            __m256i p01 = _mm256_loadu_si256(ptr + 0);
+            __m256i p23 = _mm256_loadu_si256(ptr + 1);
+            __m256i p45 = _mm256_loadu_si256(ptr + 2);
+            __m256i p67 = _mm256_loadu_si256(ptr + 3);
+
+            // Word 0 of p0, p2, p4, p6 in the low lane and of p1, p3, p5, p7
+            // in the high lane.
+            __m256i w = _mm256_unpacklo_epi64(
+                _mm256_unpacklo_epi32(p01, p23), _mm256_unpacklo_epi32(p45, p67));
+
+            __m256i hit = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi32(w, v30), _mm256_cmpeq_epi32(w, v21)),
+                _mm256_cmpeq_epi32(w, legacy));
+
+            unsigned mask = unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+
+            while (mask != 0) {
+                unsigned bit = unsigned(__builtin_ctz(mask));
+                size_t index = bit < 4 ? bit * 2 : (bit - 4) * 2 + 1;
+                check(data, (i + index) * DMI_ANCHOR_ALIGNMENT, words, result);
+                mask &= mask - 1;
+            }
+        }
+
+        return i;
+    }
+#endif
+
+#if defined(DMI_HAVE_NEON)
+    /**
+     * @brief NEON kernel, gathers the first word of 4 paragraphs at a time.
+     */
+    size_t scan_neon(std::span<const std::byte> data, size_t first,
+        size_t last, const anchor_words& words,
+        std::vector<entry_candidate>& result)
+    {
+        const uint32x4_t v30 = vdupq_n_u32(words.v30);
+        const uint32x4_t v21 = vdupq_n_u32(words.v21);
+        const uint32x4_t legacy = vdupq_n_u32(words.legacy);
+
+        size_t i = first;
+
+        for (; i + 4 <= last; i += 4) {
+            auto ptr = reinterpret_cast<const uint32_t *>(
+                data.data() + i * DMI_ANCHOR_ALIGNMENT);
+
+            // De-interleaving load, val[0] holds word 0 of each paragraph.
+            uint32x4_t w = vld4q_u32(ptr).val[0];
+
+            uint32x4_t hit = vorrq_u32(
+                vorrq_u32(vceqq_u32(w, v30), vceqq_u32(w, v21)),
+                vceqq_u32(w, legacy));
+
+            if (vmaxvq_u32(hit) == 0)
+                continue;
+
+            uint32_t lanes[4];
+            vst1q_u32(lanes, hit);
+
+            for (size_t bit = 0; bit < 4; bit++) {
+                if (lanes[bit] != 0)
+                    check(data, (i + bit) * DMI_ANCHOR_ALIGNMENT, words, result);
+            }
+        }
+
+        return i;
+    }
+#endif
+}
+
+auto dmi::scan_entries(std::span<const std::byte> data)
+    -> std::vector<entry_candidate>
+{
+    const anchor_words words;
+    std::vector<entry_candidate> result;
+
+    // Only paragraphs with at least a full anchor word are considered, which
+    // also keeps the vector loads within the buffer.
+    size_t count = data.size() < sizeof(uint32_t) ? 0 :
+        (data.size() - sizeof(uint32_t)) / DMI_ANCHOR_ALIGNMENT + 1;
+    size_t done = 0;
+
+    // Vector kernels load whole paragraphs, leave the last one to the scalar
+    // loop in case the buffer ends in the middle of it.
+    size_t full = data.size() / DMI_ANCHOR_ALIGNMENT;
+
+    switch (detail::cpu_simd()) {
+#if defined(DMI_HAVE_X86)
+    case detail::simd::avx2:
+        done = scan_avx2(data, 0, full, words, result);
+        done = scan_sse2(data, done, full, words, result);
+        break;
+    case detail::simd::sse2:
+        done = scan_sse2(data, 0, full, words, result);
+        break;
+#endif
+#if defined(DMI_HAVE_NEON)
+    case detail::simd::neon:
+        done = scan_neon(data, 0, full, words, result);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    scan_scalar(data, done, count, words, result);
+
+    std::sort(result.begin(), result.end(),
+        [](const entry_candidate& a, const entry_candidate& b)
+        {
+            if (a.valid != b.valid)
+                return a.valid;
+            if (a.type != b.type)
+                return a.type > b.type;
+            return a.offset < b.offset;
+        });
+
+    return result;
+}
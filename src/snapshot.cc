@@ -0,0 +1,389 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/snapshot.h>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+using namespace dmi;
+
+namespace
+{
+    /**
+     * @brief Identifies a snapshot, "DMIS" in memory order.
+     */
+    constexpr uint32_t snapshot_magic = 0x53494D44;
+
+    /**
+     * @brief Array stored in a snapshot, @ref offset is relative to the
+     * start of the allocation.
+     */
+    struct snapshot_section
+    {
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    /**
+     * @brief Start of the allocation, followed by the sections, each
+     * aligned to 8 bytes.
+     */
+    struct snapshot_header
+    {
+        uint32_t magic;
+        uint32_t size;
+        uint32_t version[3];
+        uint32_t handle_shift;
+        snapshot_section entry_point;
+        snapshot_section table;
+        snapshot_section records;
+        snapshot_section strings;
+        snapshot_section string_index;
+        snapshot_section by_type;
+        snapshot_section buckets;
+        snapshot_section handles;
+        snapshot_section types;
+    };
+
+    constexpr size_t section_align = 8;
+
+    constexpr size_t align(size_t size) noexcept
+    {
+        return (size + section_align - 1) & ~(section_align - 1);
+    }
+
+    inline const snapshot_header& header_of(const std::byte *data) noexcept
+    {
+        return *reinterpret_cast<const snapshot_header *>(data);
+    }
+
+    template <typename T>
+    inline std::span<const T> section_of(const std::byte *data, snapshot_section snapshot_header::*member) noexcept
+    {
+        if (data == nullptr)
+            return {};
+
+        const snapshot_section& s = header_of(data).*member;
+        return { reinterpret_cast<const T *>(data + s.offset), s.count };
+    }
+
+    /**
+     * @brief Lays the sections of a snapshot out one after another.
+     */
+    class layout
+    {
+    private:
+        size_t m_size = align(sizeof(snapshot_header));
+
+    public:
+        template <typename T>
+        snapshot_section add(size_t count)
+        {
+            size_t offset = m_size;
+            m_size = align(offset + count * sizeof(T));
+
+            if (m_size > std::numeric_limits<uint32_t>::max())
+                DMI_THROW(std::length_error("snapshot"));
+
+            return { uint32_t(offset), uint32_t(count) };
+        }
+
+        inline size_t size() const noexcept { return m_size; }
+    };
+
+    template <typename T>
+    inline void copy(std::byte *data, const snapshot_section& s, std::span<const T> source) noexcept
+    {
+        if (!source.empty())
+            std::memcpy(data + s.offset, source.data(), source.size_bytes());
+    }
+
+    std::byte *allocate(size_t size)
+    {
+        auto data = static_cast<std::byte *>(std::calloc(1, size));
+        if (data == nullptr)
+            DMI_THROW(std::bad_alloc());
+
+        return data;
+    }
+
+    /**
+     * @brief Checks that @p bytes hold a consistent snapshot, so that no
+     * lookup can read outside of it.
+     */
+    bool check(std::span<const std::byte> bytes) noexcept
+    {
+        if (bytes.size() < sizeof(snapshot_header))
+            return false;
+
+        snapshot_header h;
+        std::memcpy(&h, bytes.data(), sizeof(h));
+
+        if (h.magic != snapshot_magic || h.size != bytes.size())
+            return false;
+
+        auto fits = [&](const snapshot_section& s, size_t element) {
+            return s.offset % section_align == 0 && s.offset >= sizeof(snapshot_header) &&
+                s.offset <= h.size && s.count <= (h.size - s.offset) / element;
+        };
+
+        if (!fits(h.entry_point, 1) || !fits(h.table, 1) ||
+            !fits(h.records, sizeof(directory_record)) || !fits(h.strings, sizeof(uint16_t)) ||
+            !fits(h.string_index, sizeof(uint32_t)) || !fits(h.by_type, sizeof(uint32_t)) ||
+            !fits(h.buckets, sizeof(uint32_t)) || !fits(h.handles, sizeof(uint32_t)) ||
+            !fits(h.types, sizeof(uint64_t)))
+            return false;
+
+        const std::byte *data = bytes.data();
+
+        auto records = section_of<directory_record>(data, &snapshot_header::records);
+        auto strings = section_of<uint16_t>(data, &snapshot_header::strings);
+        auto string_index = section_of<uint32_t>(data, &snapshot_header::string_index);
+        auto by_type = section_of<uint32_t>(data, &snapshot_header::by_type);
+        auto buckets = section_of<uint32_t>(data, &snapshot_header::buckets);
+        auto handles = section_of<uint32_t>(data, &snapshot_header::handles);
+
+        if (records.empty() || string_index.size() != records.size() ||
+            by_type.size() != records.size() - 1 || buckets.size() != 257 ||
+            h.types.count != 4 || handles.size() < detail::handle_slots_min ||
+            !std::has_single_bit(handles.size()) || h.handle_shift >= 32 ||
+            h.handle_shift != 32u - unsigned(std::countr_zero(handles.size())))
+            return false;
+
+        // Structures follow each other within the table, and their strings
+        // within the string offsets.
+        for (size_t index = 0; index < records.size(); index++) {
+            if (records[index].offset > h.table.count || string_index[index] > strings.size())
+                return false;
+            if (index > 0 && (records[index].offset < records[index - 1].offset ||
+                    string_index[index] < string_index[index - 1]))
+                return false;
+        }
+
+        auto table = section_of<std::byte>(data, &snapshot_header::table);
+
+        // Each structure holds its formatted area and a string set ending
+        // with a double NUL, and its string offsets point into the set in
+        // ascending order.
+        for (size_t index = 0; index + 1 < records.size(); index++) {
+            const auto& record = records[index];
+            uint32_t size = records[index + 1].offset - record.offset;
+            auto bytes = table.subspan(record.offset, size);
+
+            if (record.length < sizeof(dmi_header_t) || record.length + 2u > size ||
+                uint8_t(bytes[offsetof(dmi_header_t, length)]) != record.length ||
+                bytes[size - 1] != std::byte(0) || bytes[size - 2] != std::byte(0))
+                return false;
+
+            for (uint32_t string = string_index[index]; string < string_index[index + 1]; string++) {
+                if (strings[string] >= size - record.length)
+                    return false;
+                if (string > string_index[index] && strings[string] <= strings[string - 1])
+                    return false;
+            }
+        }
+
+        if (buckets[0] != 0 || buckets[256] != by_type.size() ||
+            !std::ranges::is_sorted(buckets))
+            return false;
+
+        auto in_range = [&](uint32_t value) { return value < records.size() - 1; };
+        auto in_slots = [&](uint32_t value) { return value <= records.size() - 1; };
+
+        if (!std::ranges::all_of(by_type, in_range) || !std::ranges::all_of(handles, in_slots) ||
+            std::ranges::find(handles, 0u) == handles.end())
+            return false;
+
+        // Each bucket lists records of its own type only.
+        for (unsigned type = 0; type < 256; type++) {
+            for (uint32_t position = buckets[type]; position < buckets[type + 1]; position++)
+                if (records[by_type[position]].type != type)
+                    return false;
+        }
+
+        return true;
+    }
+}
+
+snapshot::snapshot() noexcept
+    : m_data(nullptr)
+{
+}
+
+snapshot::snapshot(std::byte *data) noexcept
+    : m_data(data)
+{
+}
+
+snapshot::snapshot(std::span<const std::byte> entry_point,
+    const dmi::directory& directory, const version_id& version)
+    : snapshot()
+{
+    snapshot_header h{};
+    layout l;
+
+    h.magic = snapshot_magic;
+    h.version[0] = version.major;
+    h.version[1] = version.minor;
+    h.version[2] = version.revision;
+    h.handle_shift = directory.m_handle_shift;
+
+    h.entry_point = l.add<std::byte>(entry_point.size());
+    h.table = l.add<std::byte>(directory.m_table.size());
+    h.records = l.add<directory_record>(directory.m_records.size());
+    h.strings = l.add<uint16_t>(directory.m_strings.size());
+    h.string_index = l.add<uint32_t>(directory.m_string_index.size());
+    h.by_type = l.add<uint32_t>(directory.m_by_type.size());
+    h.buckets = l.add<uint32_t>(directory.m_buckets.size());
+    h.handles = l.add<uint32_t>(directory.m_handles.size());
+    h.types = l.add<uint64_t>(directory.m_types.size());
+    h.size = uint32_t(l.size());
+
+    m_data = allocate(l.size());
+
+    std::memcpy(m_data, &h, sizeof(h));
+    copy(m_data, h.entry_point, entry_point);
+    copy(m_data, h.table, directory.m_table);
+    copy<directory_record>(m_data, h.records, directory.m_records);
+    copy<uint16_t>(m_data, h.strings, directory.m_strings);
+    copy<uint32_t>(m_data, h.string_index, directory.m_string_index);
+    copy<uint32_t>(m_data, h.by_type, directory.m_by_type);
+    copy<uint32_t>(m_data, h.buckets, directory.m_buckets);
+    copy<uint32_t>(m_data, h.handles, directory.m_handles);
+    copy<uint64_t>(m_data, h.types, directory.m_types);
+}
+
+snapshot::snapshot(const snapshot& other)
+    : snapshot()
+{
+    if (other.m_data == nullptr)
+        return;
+
+    auto bytes = other.bytes();
+    m_data = allocate(bytes.size());
+    std::memcpy(m_data, bytes.data(), bytes.size());
+}
+
+snapshot::snapshot(snapshot&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr))
+{
+}
+
+snapshot::~snapshot()
+{
+    std::free(m_data);
+}
+
+snapshot& snapshot::operator=(const snapshot& other)
+{
+    if (this != &other)
+        *this = snapshot(other);
+
+    return *this;
+}
+
+snapshot& snapshot::operator=(snapshot&& other) noexcept
+{
+    if (this != &other) {
+        std::free(m_data);
+        m_data = std::exchange(other.m_data, nullptr);
+    }
+
+    return *this;
+}
+
+auto snapshot::try_load(std::span<const std::byte> bytes) -> result<snapshot>
+{
+    if (!check(bytes))
+        return std::unexpected(error{ errc::malformed });
+
+    std::byte *data = allocate(bytes.size());
+    std::memcpy(data, bytes.data(), bytes.size());
+
+    return snapshot(data);
+}
+
+auto snapshot::load(std::span<const std::byte> bytes) -> snapshot
+{
+    auto result = try_load(bytes);
+    if (!result)
+        DMI_THROW(std::invalid_argument("bytes"));
+
+    return std::move(*result);
+}
+
+auto snapshot::bytes() const noexcept -> std::span<const std::byte>
+{
+    if (m_data == nullptr)
+        return {};
+
+    return { m_data, header_of(m_data).size };
+}
+
+auto snapshot::entry_point() const noexcept -> std::span<const std::byte>
+{
+    return section_of<std::byte>(m_data, &snapshot_header::entry_point);
+}
+
+auto snapshot::table() const noexcept -> std::span<const std::byte>
+{
+    return section_of<std::byte>(m_data, &snapshot_header::table);
+}
+
+version_id snapshot::version() const noexcept
+{
+    if (m_data == nullptr)
+        return smbios_any;
+
+    const snapshot_header& h = header_of(m_data);
+    return { h.version[0], h.version[1], h.version[2] };
+}
+
+auto snapshot::all_records() const noexcept -> std::span<const directory_record>
+{
+    return section_of<directory_record>(m_data, &snapshot_header::records);
+}
+
+auto snapshot::strings() const noexcept -> std::span<const uint16_t>
+{
+    return section_of<uint16_t>(m_data, &snapshot_header::strings);
+}
+
+auto snapshot::string_index() const noexcept -> std::span<const uint32_t>
+{
+    return section_of<uint32_t>(m_data, &snapshot_header::string_index);
+}
+
+auto snapshot::by_type() const noexcept -> std::span<const uint32_t>
+{
+    return section_of<uint32_t>(m_data, &snapshot_header::by_type);
+}
+
+auto snapshot::buckets() const noexcept -> std::span<const uint32_t>
+{
+    return section_of<uint32_t>(m_data, &snapshot_header::buckets);
+}
+
+auto snapshot::handles() const noexcept -> std::span<const uint32_t>
+{
+    return section_of<uint32_t>(m_data, &snapshot_header::handles);
+}
+
+auto snapshot::types() const noexcept -> std::span<const uint64_t>
+{
+    return section_of<uint64_t>(m_data, &snapshot_header::types);
+}
+
+unsigned snapshot::handle_shift() const noexcept
+{
+    return m_data == nullptr ? 32 : header_of(m_data).handle_shift;
+}
@@ -0,0 +1,375 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/source.h>
+#include <dmi/structure.h>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace dmi;
+
+namespace
+{
+    /**
+     * @brief Reports the current `errno` as an @ref errc::io error.
+     */
+    inline std::unexpected<error> fail_io() noexcept
+    {
+        return std::unexpected(error{ errc::io, 0xFFFF, uint32_t(errno) });
+    }
+
+    /**
+     * @brief Joins @p root and @p name into @p buffer without allocating.
+     *
+     * @return The path, or `nullptr` when it does not fit.
+     */
+    const char *make_path(char (&buffer)[PATH_MAX], std::string_view root,
+        std::string_view name) noexcept
+    {
+        while (!root.empty() && root.back() == '/')
+            root.remove_suffix(1);
+
+        if (root.size() + 1 + name.size() + 1 > sizeof(buffer))
+            return nullptr;
+
+        char *out = buffer;
+        out = std::copy(root.begin(), root.end(), out);
+        *out++ = '/';
+        out = std::copy(name.begin(), name.end(), out);
+        *out = '\0';
+
+        return buffer;
+    }
+
+    /**
+     * @brief File descriptor closed on scope exit.
+     */
+    class scoped_fd
+    {
+    private:
+        int m_fd;
+
+    public:
+        explicit scoped_fd(const char *path) noexcept
+            : m_fd(::open(path, O_RDONLY | O_CLOEXEC))
+        {
+        }
+
+        ~scoped_fd()
+        {
+            if (m_fd >= 0)
+                ::close(m_fd);
+        }
+
+        inline int get() const { return m_fd; }
+        inline explicit operator bool() const { return m_fd >= 0; }
+    };
+
+    /**
+     * @brief Reads up to @p length bytes at @p offset, retrying short reads.
+     */
+    auto read_full(int fd, void *buffer, size_t length,
+        off_t offset) noexcept -> result<size_t>
+    {
+        size_t total = 0;
+
+        while (total < length) {
+            ssize_t count = ::pread(fd, static_cast<char *>(buffer) + total,
+                length - total, offset + off_t(total));
+            if (count < 0) {
+                if (errno == EINTR)
+                    continue;
+                return fail_io();
+            }
+            if (count == 0)
+                break;
+
+            total += size_t(count);
+        }
+
+        return total;
+    }
+}
+
+source::source() noexcept
+    : m_entry{},
+      m_entry_size(0),
+      m_table(nullptr),
+      m_table_size(0),
+      m_base(nullptr),
+      m_base_size(0),
+      m_storage(storage::none)
+{
+}
+
+source::source(source&& other) noexcept
+    : m_entry(other.m_entry),
+      m_entry_size(other.m_entry_size),
+      m_table(other.m_table),
+      m_table_size(other.m_table_size),
+      m_base(other.m_base),
+      m_base_size(other.m_base_size),
+      m_storage(other.m_storage)
+{
+    other.m_entry_size = 0;
+    other.m_table = nullptr;
+    other.m_table_size = 0;
+    other.m_base = nullptr;
+    other.m_base_size = 0;
+    other.m_storage = storage::none;
+}
+
+source::~source()
+{
+    reset();
+}
+
+source& source::operator=(source&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    reset();
+
+    m_entry = other.m_entry;
+    m_entry_size = std::exchange(other.m_entry_size, 0);
+    m_table = std::exchange(other.m_table, nullptr);
+    m_table_size = std::exchange(other.m_table_size, 0);
+    m_base = std::exchange(other.m_base, nullptr);
+    m_base_size = std::exchange(other.m_base_size, 0);
+    m_storage = std::exchange(other.m_storage, storage::none);
+
+    return *this;
+}
+
+void source::reset() noexcept
+{
+    switch (m_storage) {
+    case storage::mapped:
+        ::munmap(m_base, m_base_size);
+        break;
+    case storage::heap:
+        std::free(m_base);
+        break;
+    case storage::none:
+        break;
+    }
+
+    m_entry_size = 0;
+    m_table = nullptr;
+    m_table_size = 0;
+    m_base = nullptr;
+    m_base_size = 0;
+    m_storage = storage::none;
+}
+
+auto source::try_open(std::string_view root) noexcept -> result<source>
+{
+    char path[PATH_MAX];
+    source result;
+
+    if (make_path(path, root, DMI_SYSFS_ENTRY_POINT) == nullptr)
+        return std::unexpected(error{ errc::invalid_argument });
+
+    {
+        scoped_fd fd(path);
+        if (!fd)
+            return fail_io();
+
+        auto size = read_full(fd.get(), result.m_entry.data(),
+            result.m_entry.size(), 0);
+        if (!size)
+            return std::unexpected(size.error());
+
+        result.m_entry_size = *size;
+    }
+
+    if (make_path(path, root, DMI_SYSFS_TABLE) == nullptr)
+        return std::unexpected(error{ errc::invalid_argument });
+
+    scoped_fd fd(path);
+    if (!fd)
+        return fail_io();
+
+    struct stat st;
+    if (::fstat(fd.get(), &st) < 0)
+        return fail_io();
+
+    size_t size = size_t(st.st_size);
+    if (size == 0)
+        return result;
+
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+    if (data != MAP_FAILED) {
+        result.m_table = static_cast<const std::byte *>(data);
+        result.m_table_size = size;
+        result.m_base = data;
+        result.m_base_size = size;
+        result.m_storage = storage::mapped;
+        return result;
+    }
+
+    data = std::malloc(size);
+    if (data == nullptr)
+        return std::unexpected(error{ errc::io, 0xFFFF, ENOMEM });
+
+    result.m_table = static_cast<const std::byte *>(data);
+    result.m_base = data;
+    result.m_storage = storage::heap;
+
+    auto read = read_full(fd.get(), data, size, 0);
+    if (!read)
+        return std::unexpected(read.error());
+
+    result.m_table_size = *read;
+
+    return result;
+}
+
+auto source::open(std::string_view root) -> source
+{
+    auto result = try_open(root);
+    if (!result) {
+        if (result.error().code != errc::io)
+            DMI_THROW(std::invalid_argument("root"));
+        if (result.error().offset == ENOMEM)
+            DMI_THROW(std::bad_alloc());
+
+        DMI_THROW(std::system_error(int(result.error().offset),
+            std::generic_category(), std::string(root)));
+    }
+
+    return std::move(*result);
+}
+
+auto source::try_open_entries(std::span<const table_type> types,
+    std::string_view root) noexcept -> result<source>
+{
+    // Room for one structure per read, grown for larger ones.
+    constexpr size_t chunk = 4096;
+
+    char path[PATH_MAX];
+    source result;
+    size_t capacity = 0;
+
+    for (table_type type : types) {
+        for (unsigned instance = 0;; instance++) {
+            char name[sizeof(DMI_SYSFS_ENTRIES) + 32] = DMI_SYSFS_ENTRIES "/";
+            char *out = name + sizeof(DMI_SYSFS_ENTRIES);
+            char *end = name + sizeof(name);
+
+            out = std::to_chars(out, end, unsigned(type)).ptr;
+            *out++ = '-';
+            out = std::to_chars(out, end, instance).ptr;
+            out = std::copy_n("/raw", 4, out);
+
+            if (make_path(path, root, { name, size_t(out - name) }) == nullptr)
+                return std::unexpected(error{ errc::invalid_argument });
+
+            scoped_fd fd(path);
+            if (!fd) {
+                if (errno == ENOENT)
+                    break;
+                return fail_io();
+            }
+
+            // A sysfs read returns the whole structure at once, stop as
+            // soon as it is complete rather than reading up to EOF.
+            size_t start = result.m_table_size;
+            size_t size = 0;
+
+            for (;;) {
+                if (capacity - start - size < chunk) {
+                    capacity = std::max(capacity * 2, start + size + chunk);
+                    void *data = std::realloc(result.m_base, capacity);
+                    if (data == nullptr)
+                        return std::unexpected(error{ errc::io, 0xFFFF, ENOMEM });
+
+                    result.m_table = static_cast<const std::byte *>(data);
+                    result.m_base = data;
+                    result.m_storage = storage::heap;
+                }
+
+                std::byte *buffer = const_cast<std::byte *>(result.m_table) + start;
+                ssize_t count = ::pread(fd.get(), buffer + size,
+                    capacity - start - size, off_t(size));
+                if (count < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    return fail_io();
+                }
+
+                size += size_t(count);
+                if (size != 0 && detail::structure_size(buffer, buffer + size) == size)
+                    break;
+                if (count == 0)
+                    return std::unexpected(error{ errc::malformed, 0xFFFF, uint32_t(start) });
+            }
+
+            result.m_table_size = start + size;
+        }
+    }
+
+    return result;
+}
+
+auto source::open_entries(std::span<const table_type> types,
+    std::string_view root) -> source
+{
+    auto result = try_open_entries(types, root);
+    if (!result) {
+        if (result.error().code == errc::malformed)
+            DMI_THROW(std::runtime_error("malformed entry"));
+        if (result.error().code != errc::io)
+            DMI_THROW(std::invalid_argument("root"));
+        if (result.error().offset == ENOMEM)
+            DMI_THROW(std::bad_alloc());
+
+        DMI_THROW(std::system_error(int(result.error().offset),
+            std::generic_category(), std::string(root)));
+    }
+
+    return std::move(*result);
+}
+
+auto source::try_borrow(std::span<const std::byte> entry_point,
+    std::span<const std::byte> table) noexcept -> dmi::result<source>
+{
+    if (entry_point.size() > DMI_ENTRY_POINT_MAX)
+        return std::unexpected(error{ errc::invalid_argument, 0xFFFF, DMI_ENTRY_POINT_MAX });
+
+    source result;
+
+    if (!entry_point.empty())
+        std::memcpy(result.m_entry.data(), entry_point.data(), entry_point.size());
+    result.m_entry_size = entry_point.size();
+    result.m_table = table.data();
+    result.m_table_size = table.size();
+
+    return result;
+}
+
+auto source::borrow(std::span<const std::byte> entry_point,
+    std::span<const std::byte> table) -> source
+{
+    auto result = try_borrow(entry_point, table);
+    if (!result)
+        DMI_THROW(std::invalid_argument("entry_point"));
+
+    return std::move(*result);
+}
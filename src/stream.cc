@@ -0,0 +1,152 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/stream.h>
+#include <dmi/strings.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace dmi;
+
+namespace
+{
+    inline std::unexpected<error> fail(errc code, uint64_t offset) noexcept
+    {
+        return std::unexpected(error{ code, 0xFFFF, uint32_t(offset) });
+    }
+}
+
+stream_parser::stream_parser() noexcept
+    : m_offset(0),
+      m_complete(false),
+      m_done(false)
+{
+}
+
+auto stream_parser::try_next(std::span<const std::byte>& chunk)
+    -> result<std::optional<structure>>
+{
+    for (;;) {
+        if (m_complete) {
+            m_partial.clear();
+            m_complete = false;
+        }
+
+        if (m_done) {
+            chunk = {};
+            return std::nullopt;
+        }
+
+        if (chunk.empty())
+            return std::nullopt;
+
+        std::optional<structure> found;
+
+        // Fast path: the whole structure is in the chunk, no copy. The
+        // string set is bounded as below, so that the outcome does not
+        // depend on how the input is split.
+        if (m_partial.empty()) {
+            size_t size = detail::structure_size(chunk.data(),
+                chunk.data() + chunk.size());
+            if (size != 0) {
+                found = structure(chunk.data(), size);
+                chunk = chunk.subspan(size);
+                m_offset += size;
+            } else if (chunk.size() >= 2 && uint8_t(chunk[1]) >= sizeof(dmi_header_t) &&
+                chunk.size() > uint8_t(chunk[1]) + size_t(DMI_STRINGS_SIZE_MAX)) {
+                m_done = true;
+                return fail(errc::bad_length, m_offset);
+            }
+        }
+
+        if (!found) {
+            auto take = [&](size_t count) {
+                count = std::min(count, chunk.size());
+                m_partial.insert(m_partial.end(), chunk.begin(), chunk.begin() + count);
+                chunk = chunk.subspan(count);
+            };
+
+            // Header, up to the length field.
+            if (m_partial.size() < 2) {
+                take(2 - m_partial.size());
+                if (m_partial.size() < 2)
+                    return std::nullopt;
+            }
+
+            size_t length = uint8_t(m_partial[1]);
+            if (length < sizeof(dmi_header_t)) {
+                m_done = true;
+                return fail(errc::bad_length, m_offset + offsetof(dmi_header_t, length));
+            }
+
+            // Formatted area.
+            if (m_partial.size() < length) {
+                take(length - m_partial.size());
+                if (m_partial.size() < length)
+                    return std::nullopt;
+            }
+
+            // String set, up to the first double NUL after the formatted
+            // area, the previous chunk possibly ending with the first NUL.
+            const std::byte *begin = chunk.data();
+            const std::byte *end = begin + chunk.size();
+            const std::byte *pos = begin;
+            size_t size = 0;
+
+            if (m_partial.size() > length && m_partial.back() == std::byte(0) &&
+                pos < end && *pos == std::byte(0))
+                size = 1;
+
+            while (size == 0 && pos < end) {
+                auto zero = static_cast<const std::byte *>(
+                    std::memchr(pos, 0, size_t(end - pos)));
+                if (zero == nullptr || zero + 1 == end)
+                    break;
+                if (zero[1] == std::byte(0))
+                    size = size_t(zero + 2 - begin);
+                pos = zero + 1;
+            }
+
+            take(size != 0 ? size : chunk.size());
+
+            if (m_partial.size() - length > DMI_STRINGS_SIZE_MAX) {
+                m_done = true;
+                return fail(errc::bad_length, m_offset);
+            }
+
+            if (size == 0)
+                return std::nullopt;
+
+            found = structure(m_partial.data(), m_partial.size());
+            m_complete = true;
+            m_offset += m_partial.size();
+        }
+
+        uint8_t type = uint8_t(found->type());
+
+        if (type == DMI_TABLE_END_OF_TABLE) [[unlikely]] {
+            m_done = true;
+            chunk = {};
+            return std::nullopt;
+        }
+        if (type != DMI_TABLE_INACTIVE) [[likely]]
+            return found;
+    }
+}
+
+auto stream_parser::try_finish() const noexcept -> result<void>
+{
+    if (pending() != 0)
+        return fail(errc::truncated, m_offset);
+
+    return {};
+}
+
+void stream_parser::finish() const
+{
+    if (!try_finish())
+        DMI_THROW(std::runtime_error("truncated structure"));
+}
@@ -0,0 +1,208 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/strings.h>
+
+#include <algorithm>
+#include <bit>
+
+#include "cpu.h"
+
+using namespace dmi;
+
+namespace
+{
+    /**
+     * @brief Scan state shared by the kernels.
+     *
+     * @details
+     * Strings are recorded when the NUL that ends them is seen, @ref start is
+     * the offset of the string in progress.
+     */
+    struct scanner
+    {
+        std::span<uint16_t> offsets;
+        size_t count = 0;
+        size_t start = 0;
+
+        inline void separator(size_t pos) noexcept
+        {
+            if (count < offsets.size())
+                offsets[count] = uint16_t(start);
+            count++;
+            start = pos + 1;
+        }
+
+        inline string_scan terminator(size_t pos) noexcept
+        {
+            // An empty set is just the double NUL, otherwise the first NUL
+            // of the pair ends the last string.
+            if (pos > 0)
+                separator(pos);
+
+            return { pos + 2, count };
+        }
+
+        /**
+         * @brief Processes a block whose NUL bytes are flagged in @p nul, with
+         * @p Step mask bits per byte, starting at offset @p base.
+         *
+         * @details
+         * Only the first @p span bytes are considered, the next one must be
+         * flagged in @p nul as well so that a double NUL is never split.
+         */
+        template <unsigned Step, typename Mask>
+        inline bool block(Mask nul, size_t base, unsigned span,
+            string_scan& result) noexcept
+        {
+            constexpr Mask lsb = Mask(1);
+
+            Mask valid = (lsb << (span * Step)) - 1;
+            Mask pair = nul & (nul >> Step) & valid;
+
+            nul &= valid;
+
+            if (pair != 0) {
+                unsigned bit = unsigned(std::countr_zero(pair));
+                nul &= (lsb << bit) - 1;
+
+                for (; nul != 0; nul &= nul - 1)
+                    separator(base + unsigned(std::countr_zero(nul)) / Step);
+
+                result = terminator(base + bit / Step);
+                return true;
+            }
+
+            for (; nul != 0; nul &= nul - 1)
+                separator(base + unsigned(std::countr_zero(nul)) / Step);
+
+            return false;
+        }
+    };
+
+    string_scan scan_scalar(std::span<const std::byte> data, size_t pos,
+        scanner& state) noexcept
+    {
+        for (; pos + 1 < data.size(); pos++) {
+            if (data[pos] != std::byte(0))
+                continue;
+            if (data[pos + 1] == std::byte(0))
+                return state.terminator(pos);
+
+            state.separator(pos);
+        }
+
+        return { 0, state.count };
+    }
+
+#if defined(DMI_HAVE_X86)
+    /**
+     * @brief SSE2 kernel.
+     *
+     * @details
+     * Loads 16 bytes and consumes 15, so that the byte following the last
+     * consumed one is always in the same register. The other vector kernels
+     * work the same way.
+     */
+    __attribute__((target("sse2")))
+    string_scan scan_sse2(std::span<const std::byte> data, scanner& state) noexcept
+    {
+        constexpr unsigned width = 16;
+        const __m128i zero = _mm_setzero_si128();
+
+        size_t pos = 0;
+        string_scan result;
+
+        for (; pos + width <= data.size(); pos += width - 1) {
+            __m128i v = _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(data.data() + pos));
+            uint32_t nul = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+
+            if (state.block<1>(nul, pos, width - 1, result))
+                return result;
+        }
+
+        return scan_scalar(data, pos, state);
+    }
+
+    /**
+     * @brief AVX2 kernel.
+     */
+    __attribute__((target("avx2")))
+    string_scan scan_avx2(std::span<const std::byte> data, scanner& state) noexcept
+    {
+        constexpr unsigned width = 32;
+        const __m256i zero = _mm256_setzero_si256();
+
+        size_t pos = 0;
+        string_scan result;
+
+        for (; pos + width <= data.size(); pos += width - 1) {
+            __m256i v = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(data.data() + pos));
+            uint64_t nul = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)));
+
+            if (state.block<1>(nul, pos, width - 1, result))
+                return result;
+        }
+
+        return scan_scalar(data, pos, state);
+    }
+#endif
+
+#if defined(DMI_HAVE_NEON)
+    /**
+     * @brief NEON kernel.
+     *
+     * @details
+     * NEON has no byte mask extraction, narrowing the comparison result by
+     * 4 bits gives a 64-bit mask with a nibble per byte instead.
+     */
+    string_scan scan_neon(std::span<const std::byte> data, scanner& state) noexcept
+    {
+        constexpr unsigned width = 16;
+
+        size_t pos = 0;
+        string_scan result;
+
+        for (; pos + width <= data.size(); pos += width - 1) {
+            uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(data.data() + pos));
+            uint8x16_t eq = vceqzq_u8(v);
+            uint64_t nul = vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+
+            // Keep one bit per nibble so that mask arithmetic stays exact.
+            nul &= 0x1111111111111111ull;
+
+            if (state.block<4>(nul, pos, width - 1, result))
+                return result;
+        }
+
+        return scan_scalar(data, pos, state);
+    }
+#endif
+}
+
+auto dmi::scan_strings(std::span<const std::byte> data,
+    std::span<uint16_t> offsets) noexcept -> string_scan
+{
+    data = data.first(std::min<size_t>(data.size(), DMI_STRINGS_SIZE_MAX));
+
+    scanner state{ offsets };
+
+    switch (detail::cpu_simd()) {
+#if defined(DMI_HAVE_X86)
+    case detail::simd::avx2:
+        return scan_avx2(data, state);
+    case detail::simd::sse2:
+        return scan_sse2(data, state);
+#endif
+#if defined(DMI_HAVE_NEON)
+    case detail::simd::neon:
+        return scan_neon(data, state);
+#endif
+    default:
+        return scan_scalar(data, 0, state);
+    }
+}
@@ -1 +1,7 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
 #include <dmi/table/cache.h>
+
+using namespace dmi::table;
@@ -0,0 +1,103 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <dmi/validate.h>
+#include <dmi/table/cache.h>
+#include <dmi/table/cooling-device.h>
+#include <dmi/table/system.h>
+#include <dmi/table/generated/tables.h>
+
+using namespace dmi;
+
+namespace
+{
+    struct reporter
+    {
+        std::vector<validation_issue> *issues;
+        bool valid = true;
+
+        inline void operator()(validation_error error, uint32_t offset, handle_t handle)
+        {
+            valid = false;
+            if (issues != nullptr)
+                issues->push_back({ error, offset, handle });
+        }
+    };
+
+    /**
+     * @brief Checks the structures of type `T::structure_type`.
+     */
+    template <typename T>
+    void validate_type(const directory& directory, size_t min_length, reporter& report)
+    {
+        using view = typename T::view_type;
+
+        for (uint32_t index : directory.indices(uint8_t(T::structure_type))) {
+            const auto& record = directory.records()[index];
+            auto structure = directory.at(index);
+
+            if (record.length < min_length)
+                report(validation_error::short_structure, record.offset, record.handle);
+
+            for (size_t offset : view::string_fields) {
+                if (!structure.covers(offset, 1))
+                    continue;
+                if (uint8_t(structure.data()[offset]) > structure.string_count()) {
+                    report(validation_error::string_index, record.offset, record.handle);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+bool dmi::validate(const directory& directory, const version_id& version,
+    const version_id& min, std::vector<validation_issue> *issues)
+{
+    reporter report{ issues };
+
+    if (version < min)
+        report(validation_error::version, 0, 0xFFFF);
+
+    // The directory stops at the end-of-table structure, at the end of the
+    // buffer or at the first malformed structure: tell the last one apart.
+    auto table = directory.table();
+    auto records = directory.records();
+    size_t offset = records.empty() ? 0 : records.back().offset;
+
+    if (!records.empty()) {
+        auto last = directory.at(records.size() - 1);
+        offset += last.data().size();
+    }
+
+    if (offset < table.size()) {
+        auto rest = table.subspan(offset);
+
+        if (rest.size() < sizeof(dmi_header_t)) {
+            report(validation_error::truncated, uint32_t(offset), 0xFFFF);
+        } else {
+            uint8_t length = DMI_FIELD(rest.data(), dmi_header_t, length);
+            handle_t handle = DMI_FIELD(rest.data(), dmi_header_t, handle);
+
+            if (length < sizeof(dmi_header_t) || length + 2u > rest.size())
+                report(validation_error::truncated, uint32_t(offset), handle);
+            else if (detail::structure_size(rest.data(), rest.data() + rest.size()) == 0)
+                report(validation_error::unterminated_strings, uint32_t(offset), handle);
+        }
+    }
+
+    for (size_t index = 0; index < records.size(); index++) {
+        if (directory.index_of(records[index].handle) != index)
+            report(validation_error::duplicate_handle, records[index].offset, records[index].handle);
+    }
+
+#define DMI_VALIDATE_TYPE(name) \
+    validate_type<table::name>(directory, table::name##_length(min), report);
+
+    DMI_ENABLED_TABLES(DMI_VALIDATE_TYPE)
+
+#undef DMI_VALIDATE_TYPE
+
+    return report.valid;
+}
@@ -0,0 +1,117 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dmi/error.h>
+#include <dmi/source.h>
+#include <dmi/stream.h>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char *what)
+    {
+        if (!condition) {
+            std::fprintf(stderr, "import: %s\n", what);
+            failures++;
+        }
+    }
+
+    void append(std::vector<std::byte>& table, std::initializer_list<int> formatted,
+        std::string_view strings)
+    {
+        for (int byte : formatted)
+            table.push_back(std::byte(byte));
+        for (char c : strings)
+            table.push_back(std::byte(c));
+    }
+
+    /**
+     * @brief Prints @p structure to @p text the way dmi-dump does.
+     */
+    void print(std::string& text, const dmi::structure& structure)
+    {
+        char line[64];
+
+        std::snprintf(line, sizeof(line), "Handle 0x%04X, DMI type %u, %u bytes\n",
+            unsigned(structure.handle()), unsigned(structure.type()),
+            unsigned(structure.length()));
+        text += line;
+
+        text += "\tHeader and Data:";
+        auto formatted = structure.formatted();
+        for (size_t i = 0; i < formatted.size(); i++) {
+            std::snprintf(line, sizeof(line), "%s%02X", i % 16 == 0 ? "\n\t\t" : " ", unsigned(formatted[i]));
+            text += line;
+        }
+        text += "\n";
+
+        auto strings = structure.strings();
+        if (strings.size() > 2) {
+            text += "\tStrings:\n";
+            for (size_t i = 0; i + 1 < strings.size() && strings[i] != std::byte(0);) {
+                auto string = reinterpret_cast<const char *>(strings.data() + i);
+                text += "\t\t";
+                text += string;
+                text += "\n";
+                i += std::strlen(string) + 1;
+            }
+        }
+
+        text += "\n";
+    }
+
+    /**
+     * @brief Splits @p table into its structures, serialized, none if it
+     * is malformed.
+     */
+    std::vector<std::vector<std::byte>> split(std::span<const std::byte> table)
+    {
+        std::vector<std::vector<std::byte>> structures;
+        dmi::stream_parser parser;
+
+        auto pushed = parser.try_push(table, [&](const dmi::structure& structure) {
+            auto data = structure.data();
+            structures.emplace_back(data.begin(), data.end());
+        });
+        if (!pushed || !parser.try_finish())
+            structures.clear();
+
+        return structures;
+    }
+}
+
+int main()
+{
+    // Strings that read as hex dump lines must come back as text, whether
+    // another string follows them or the structure ends.
+    std::vector<std::byte> table;
+    append(table, { 1, 0x08, 0x00, 0x01, 1, 2, 3, 4 },
+        std::string_view("Acme\0" "01\0" "12 34\0" "FF\0\0", 18));
+    append(table, { 2, 0x06, 0x01, 0x01, 1, 2 }, std::string_view("FF\0" "0A 0B\0\0", 10));
+    append(table, { 127, 0x04, 0x02, 0x01 }, std::string_view("\0\0", 2));
+
+    std::string text;
+    dmi::stream_parser parser;
+    parser.push(table, [&](const dmi::structure& structure) { print(text, structure); });
+    parser.finish();
+
+    auto source = dmi::source::try_import_text(text);
+    check(source.has_value(), "dmi-dump output does not import");
+    if (!source)
+        return EXIT_FAILURE;
+
+    auto expected = split(table);
+    auto imported = split(source->table());
+    check(imported == expected, "imported structures differ from the dumped ones");
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
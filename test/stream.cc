@@ -0,0 +1,114 @@
+//
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: (c) 2025, Dmitry Novikov <cat@aspie.ru>
+//
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dmi/error.h>
+#include <dmi/stream.h>
+#include <dmi/strings.h>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char *what, size_t split)
+    {
+        if (!condition) {
+            std::fprintf(stderr, "stream: %s, split at %zu\n", what, split);
+            failures++;
+        }
+    }
+
+    void append(std::vector<std::byte>& table, std::initializer_list<int> formatted,
+        std::string_view strings)
+    {
+        for (int byte : formatted)
+            table.push_back(std::byte(byte));
+        for (char c : strings)
+            table.push_back(std::byte(c));
+    }
+
+    /**
+     * @brief Outcome of parsing a table: the structures emitted, each
+     * serialized, or the error.
+     */
+    struct outcome
+    {
+        std::vector<std::vector<std::byte>> structures;
+        dmi::errc error = {};
+
+        bool operator==(const outcome&) const = default;
+    };
+
+    /**
+     * @brief Parses @p table fed in two chunks, split at @p split.
+     */
+    outcome parse(std::span<const std::byte> table, size_t split)
+    {
+        dmi::stream_parser parser;
+        outcome result;
+
+        auto emit = [&](const dmi::structure& structure) {
+            auto data = structure.data();
+            result.structures.emplace_back(data.begin(), data.end());
+        };
+
+        for (auto chunk : { table.first(split), table.subspan(split) }) {
+            auto pushed = parser.try_push(chunk, emit);
+            if (!pushed) {
+                result.error = pushed.error().code;
+                return result;
+            }
+        }
+
+        if (auto finished = parser.try_finish(); !finished)
+            result.error = finished.error().code;
+
+        return result;
+    }
+
+    /**
+     * @brief Checks that @p table parses the same wherever it is split.
+     */
+    void check_splits(std::span<const std::byte> table, const outcome& expected, const char *what)
+    {
+        for (size_t split = 0; split <= table.size(); split++)
+            check(parse(table, split) == expected, what, split);
+    }
+}
+
+int main()
+{
+    // Three structures, with no strings, strings, and an empty string set
+    // ending the formatted area right at a chunk boundary candidate.
+    std::vector<std::byte> table;
+    append(table, { 0, 0x12, 0x00, 0x00, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+        std::string_view("Vendor\0Version\0\0", 16));
+    append(table, { 1, 0x08, 0x01, 0x00, 1, 2, 0, 3 }, std::string_view("Acme\0Box\0SN\0\0", 13));
+    append(table, { 3, 0x05, 0x02, 0x00, 0x01 }, std::string_view("\0\0", 2));
+    append(table, { 127, 0x04, 0x03, 0x00 }, std::string_view("\0\0", 2));
+
+    auto whole = parse(table, table.size());
+    check(whole.structures.size() == 3 && whole.error == dmi::errc{}, "valid table", table.size());
+    check_splits(table, whole, "valid table");
+
+    // A string set one byte over the bound fails the same, however split.
+    std::vector<std::byte> oversized;
+    append(oversized, { 1, 0x04, 0x00, 0x00 }, {});
+    oversized.insert(oversized.end(), DMI_STRINGS_SIZE_MAX - 1, std::byte('a'));
+    append(oversized, {}, std::string_view("\0\0", 2));
+
+    auto rejected = parse(oversized, oversized.size());
+    check(rejected.error == dmi::errc::bad_length, "oversized string set", oversized.size());
+    for (size_t split : { size_t(0), size_t(1), size_t(2), size_t(4), size_t(4096), oversized.size() - 1 })
+        check(parse(oversized, split) == rejected, "oversized string set", split);
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}